@@ -8,6 +8,8 @@
 #include <notification/notification.h>
 #include <notification/notification_messages.h>
 #include <storage/storage.h>
+#include <u8g2.h>
+#include <stdatomic.h>
 
 #ifdef HID_TRANSPORT_BLE
 #include <bt/bt_service/bt.h>
@@ -74,6 +76,7 @@ typedef enum {
     ManualViewSections,
     ManualViewRead,
     ManualViewQuiz,
+    ManualViewSearch,
 } ManualView;
 
 /* ── Manual content structures (all const, zero malloc) ── */
@@ -89,6 +92,25 @@ typedef struct {
     uint8_t section_count;
 } ManualCategory;
 
+/* one screen line of pre-wrapped text, see manual_layout.h */
+typedef struct {
+    uint16_t offset; /* into the content as interned, or the card's description */
+    uint8_t length;  /* characters, fragments expanded */
+    uint8_t indent; /* spaces drawn before it */
+} LayoutLine;
+
+/* one word of the search index, see manual_index.h */
+typedef struct {
+    uint16_t word;    /* offset into search_words */
+    uint16_t posting; /* its first search_postings entry; the next term's is the end */
+} SearchTerm;
+
+/* reads manual text with its interned fragments expanded */
+typedef struct {
+    const char* text;
+    const char* fragment; /* inside manual_fragments[], or NULL */
+} ManualCursor;
+
 typedef enum {
     QuizTypeMultiChoice,
 } QuizType;
@@ -104,636 +126,811 @@ typedef struct {
 } QuizCard;
 
 /* ══════════════════════════════════════════════════════════
- *  Compiled-in manual content (≤30 chars/line for 128x64)
+ *  Compiled-in manual content, generated from manual/manual.txt
+ *  by tools/gen_manual.py: sections, categories[] and quiz_cards[].
+ *  Section text is interned, see manual_next().
  * ══════════════════════════════════════════════════════════ */
 
-/* ── Getting Started ── */
-
-static const ManualSection setup_sections[] = {
-    {"Installing Claude",
-     "Install via npm:\n"
-     " npm i -g @anthropic-ai/\n"
-     "   claude-code\n\n"
-     "Or via brew:\n"
-     " brew install claude-code\n\n"
-     "Requires Node.js 18+\n"
-     "and an Anthropic API key.\n\n"
-     "Set your key:\n"
-     " export ANTHROPIC_API_KEY\n"
-     "   =sk-ant-...\n\n"
-     "Or log in with:\n"
-     " claude login\n"},
-
-    {"First Launch",
-     "Open any terminal and type:\n"
-     " claude\n\n"
-     "Claude starts in your\n"
-     "current directory. It reads\n"
-     "all files in your project.\n\n"
-     "Start fresh:\n"
-     " claude --new\n\n"
-     "Resume last session:\n"
-     " claude --continue\n\n"
-     "Print mode (no chat):\n"
-     " claude -p \"your query\"\n\n"
-     "Type your request at the\n"
-     "> prompt and press Enter.\n"},
-
-    {"System Requirements",
-     "Supported platforms:\n"
-     " macOS, Linux, WSL\n\n"
-     "Requirements:\n"
-     " Node.js 18 or later\n"
-     " npm or brew\n"
-     " Terminal with UTF-8\n\n"
-     "Recommended:\n"
-     " Git installed\n"
-     " Project in a git repo\n"
-     " CLAUDE.md in project root\n\n"
-     "API key or Claude login\n"
-     "required for operation.\n"},
-
-    {"Authentication",
-     "Two ways to authenticate:\n\n"
-     "1. Claude Max subscription\n"
-     "   claude login\n"
-     "   Opens browser to sign in\n\n"
-     "2. API key\n"
-     "   export ANTHROPIC_API_KEY\n"
-     "     =sk-ant-...\n\n"
-     "Manage sessions:\n"
-     " /login   sign in again\n"
-     " /logout  sign out\n"
-     " /status  check auth state\n\n"
-     "Max: flat monthly rate.\n"
-     "API: pay per token used.\n"},
-};
+#include "manual_content.h"
+#define MENU_ITEM_COUNT (CATEGORY_COUNT + 2) /* +1 for Quiz, +1 for Search */
+#define MENU_QUIZ CATEGORY_COUNT
+#define MENU_SEARCH (CATEGORY_COUNT + 1)
 
-/* ── Workspace ── */
-
-static const ManualSection workspace_sections[] = {
-    {"Ideal Project Setup",
-     "Best results when Claude\n"
-     "can see your full project.\n\n"
-     "Recommended layout:\n"
-     " project/\n"
-     "   CLAUDE.md\n"
-     "   .claude/\n"
-     "   src/\n"
-     "   tests/\n"
-     "   package.json\n\n"
-     "Always run claude from\n"
-     "your project root dir.\n\n"
-     "Keep projects in git so\n"
-     "Claude can see history\n"
-     "and you can revert.\n"},
-
-    {"CLAUDE.md Guide",
-     "CLAUDE.md is a file Claude\n"
-     "reads automatically when\n"
-     "starting in a directory.\n\n"
-     "Use it to tell Claude:\n"
-     " - Project description\n"
-     " - Architecture notes\n"
-     " - Coding conventions\n"
-     " - Build/test commands\n"
-     " - Key file locations\n\n"
-     "Claude reads CLAUDE.md at\n"
-     "every session start. No\n"
-     "need to repeat context.\n\n"
-     "Place it in project root.\n"},
-
-    {"The /init Command",
-     "/init creates a CLAUDE.md\n"
-     "for your project.\n\n"
-     "Usage:\n"
-     " 1. Open claude in your\n"
-     "    project directory\n"
-     " 2. Type /init\n"
-     " 3. Claude analyzes your\n"
-     "    codebase\n"
-     " 4. Generates a CLAUDE.md\n\n"
-     "The file includes:\n"
-     " - Tech stack details\n"
-     " - Project structure\n"
-     " - Build commands\n"
-     " - Coding patterns found\n\n"
-     "Edit it to add your own\n"
-     "instructions or rules.\n"},
-
-    {".claude/ Directory",
-     "The .claude/ directory\n"
-     "stores project settings.\n\n"
-     "Structure:\n"
-     " .claude/\n"
-     "   settings.json\n"
-     "   skills/\n"
-     "     custom_skill.md\n\n"
-     "settings.json:\n"
-     " Stores allowed tools\n"
-     " and permissions.\n\n"
-     "skills/:\n"
-     " Custom skill files\n"
-     " Claude loads on start.\n\n"
-     "Commit .claude/ to share\n"
-     "config with your team.\n"},
-
-    {"Skills System",
-     "Skills are reusable prompts\n"
-     "Claude loads automatically.\n\n"
-     "Location:\n"
-     " .claude/skills/*.md\n\n"
-     "Each .md file is a skill.\n"
-     "Claude reads them at start\n"
-     "like CLAUDE.md.\n\n"
-     "Use for:\n"
-     " - Custom workflows\n"
-     " - Code review rules\n"
-     " - Response templates\n"
-     " - Domain knowledge\n\n"
-     "Skills replace the old\n"
-     "custom slash commands.\n"},
-};
+#define SEARCH_QUERY_MAX 12
+#define SEARCH_HIT_MAX 24
+#define SEARCH_VISIBLE 3
 
-/* ── Commands ── */
-
-static const ManualSection commands_sections[] = {
-    {"Navigation & Basics",
-     "Key shortcuts:\n"
-     " Ctrl+C Cancel/interrupt\n"
-     " Ctrl+D Exit Claude Code\n"
-     " Esc    Cancel input\n"
-     " Tab    Autocomplete\n\n"
-     "Approval prompts:\n"
-     " 1  Yes / approve\n"
-     " 2  No / decline\n"
-     " 3  Other / alternative\n\n"
-     "Scrolling:\n"
-     " Up/Down for history\n\n"
-     "Voice (macOS):\n"
-     " Down  Start Dictation\n"},
-
-    {"Session Management",
-     "/clear\n"
-     " Wipe conversation history\n"
-     " Start fresh in same dir\n\n"
-     "/compact\n"
-     " Summarize conversation\n"
-     " Reduces token usage\n"
-     " Use when context is big\n\n"
-     "/cost\n"
-     " Show token usage and\n"
-     " estimated cost for\n"
-     " current session\n\n"
-     "Sessions persist. Use\n"
-     " --continue to resume\n"
-     " --new to start fresh\n"},
-
-    {"Configuration",
-     "/config\n"
-     " Open settings editor\n"
-     " Set model, theme, key\n\n"
-     "/terminal-setup\n"
-     " Fix terminal rendering\n"
-     " and display issues\n\n"
-     "Key settings:\n"
-     " Model selection\n"
-     " Auto-approve patterns\n"
-     " Theme (light/dark)\n"
-     " Notification sounds\n\n"
-     "Settings stored in:\n"
-     " ~/.claude/config.json\n"},
-
-    {"Debugging",
-     "/doctor\n"
-     " Diagnose setup issues\n"
-     " Check API connection\n"
-     " Verify permissions\n\n"
-     "Common issues:\n\n"
-     " \"API key not found\"\n"
-     "  -> export your key\n\n"
-     " \"Permission denied\"\n"
-     "  -> Check /config\n\n"
-     " Slow responses:\n"
-     "  -> /compact to reduce\n"
-     "     conversation size\n\n"
-     " Display broken:\n"
-     "  -> /terminal-setup\n"},
-
-    {"Slash Commands A-M",
-     "/bug\n"
-     " Report a Claude Code bug\n\n"
-     "/commit\n"
-     " Auto-generate a commit\n"
-     " message and commit\n\n"
-     "/listen\n"
-     " Pause and wait for\n"
-     " file changes to resume\n\n"
-     "/login\n"
-     " Sign in to Anthropic\n\n"
-     "/logout\n"
-     " Sign out of session\n\n"
-     "/memory\n"
-     " Edit CLAUDE.md quickly\n\n"
-     "/model\n"
-     " Switch AI model mid-chat\n"
-     " Opus, Sonnet, or Haiku\n\n"
-     "/mcp\n"
-     " Manage MCP servers\n"},
-
-    {"Slash Commands N-Z",
-     "/permissions\n"
-     " View and edit tool\n"
-     " access for this session\n\n"
-     "/pr-comments\n"
-     " Fetch GitHub PR review\n"
-     " comments into session\n\n"
-     "/rewind\n"
-     " Undo to a previous\n"
-     " point in conversation\n\n"
-     "/status\n"
-     " Show auth, model, and\n"
-     " session info\n\n"
-     "/vim\n"
-     " Toggle vim keybindings\n"
-     " in the input editor\n"},
-};
+#define QUIZ_ROUND_MAX 24 /* Hard; quiz_order holds one round */
+#define QUIZ_QUESTION_LINES 2 /* the options fill the rest of the screen */
+#define QUIZ_BANK_PATH APP_DATA_PATH("quiz.bank")
+#define QUIZ_RECORD_MAX 256
+#define QUIZ_BOXES_PATH APP_DATA_PATH("quiz.boxes") /* built-in cards */
+#define QUIZ_BANK_BOXES_PATH APP_DATA_PATH("quiz.bank.boxes")
+#define QUIZ_BOX_MAX 5
 
-/* ── Tools ── */
-
-static const ManualSection tools_sections[] = {
-    {"File Operations",
-     "Read\n"
-     " View file contents\n"
-     " Supports images & PDFs\n\n"
-     "Write\n"
-     " Create new files\n"
-     " Overwrites if exists\n\n"
-     "Edit\n"
-     " Modify existing files\n"
-     " Find and replace text\n"
-     " Preserves context\n\n"
-     "NotebookEdit\n"
-     " Edit Jupyter notebooks\n"
-     " Add/remove/replace cells\n"},
-
-    {"Search & Explore",
-     "Grep\n"
-     " Search file contents\n"
-     " Regex pattern matching\n"
-     " Filter by file type\n\n"
-     "Glob\n"
-     " Find files by name\n"
-     " Pattern matching\n"
-     " e.g. \"**/*.ts\"\n\n"
-     "Task (Explore agent)\n"
-     " Search across codebase\n"
-     " Find implementations\n"
-     " Answer architecture Q's\n\n"
-     "Let Claude search rather\n"
-     "than pasting file paths.\n"},
-
-    {"Sub-agents & Web",
-     "Task\n"
-     " Launch sub-agents:\n"
-     " Bash, Explore, Plan,\n"
-     " general-purpose\n\n"
-     "Bash\n"
-     " Run shell commands\n"
-     " Git, npm, tests, builds\n\n"
-     "WebFetch\n"
-     " Fetch and analyze URLs\n\n"
-     "WebSearch\n"
-     " Search the internet\n"
-     " Get current info\n\n"
-     "Agents run independently\n"
-     "and return results.\n"},
-};
+/* ── Settings & Macros constants ── */
 
-/* ── Workflows ── */
-
-static const ManualSection workflows_sections[] = {
-    {"New Project Setup",
-     "Step 1:\n"
-     " claude --new\n\n"
-     "Step 2:\n"
-     " Type /init\n"
-     " Creates CLAUDE.md\n\n"
-     "Step 3:\n"
-     " Describe what you want.\n"
-     " Be specific about\n"
-     " your tech stack.\n\n"
-     "Step 4:\n"
-     " Approve actions with 1\n"
-     " Decline with 2\n\n"
-     "Tip: Commit after each\n"
-     "major milestone.\n"},
-
-    {"Debug & Test",
-     "Step 1:\n"
-     " Paste error or test\n"
-     " output into Claude.\n\n"
-     "Step 2:\n"
-     " Claude reads relevant\n"
-     " source files.\n\n"
-     "Step 3:\n"
-     " Review proposed fix.\n"
-     " Press 1 to approve\n"
-     " or 2 to decline.\n\n"
-     "Step 4:\n"
-     " Run tests to verify.\n\n"
-     "Tip: /compact if the\n"
-     "conversation gets long.\n"},
-
-    {"Code Review",
-     "Step 1:\n"
-     " Type /review or paste\n"
-     " a GitHub PR URL.\n\n"
-     "Step 2:\n"
-     " Claude reads all\n"
-     " changes in the diff.\n\n"
-     "Step 3:\n"
-     " Get feedback on:\n"
-     "  - Bug risks\n"
-     "  - Style issues\n"
-     "  - Performance\n"
-     "  - Missing tests\n\n"
-     "Step 4:\n"
-     " Ask Claude to fix\n"
-     " issues it found.\n"},
-
-    {"Git & PRs",
-     "Commit workflow:\n"
-     " 1. Make changes w/ Claude\n"
-     " 2. Type /commit\n"
-     " 3. Claude writes message\n"
-     " 4. Approve to commit\n\n"
-     "PR review:\n"
-     " Paste a PR URL or use\n"
-     " /pr-comments to fetch\n"
-     " review feedback.\n\n"
-     "Tips:\n"
-     " Keep project in git repo\n"
-     " Commit after milestones\n"
-     " Claude reads git history\n"
-     " for better context.\n"},
-};
+#define APP_DATA_DIR APP_DATA_PATH("")
+#define SETTINGS_PATH APP_DATA_PATH("settings.bin")
+#define SETTINGS_TEXT_PATH APP_DATA_PATH("settings.cfg") /* pre-binary format, migrated once */
+#define SETTINGS_COUNT 6
+#define SETTINGS_VISIBLE 3
 
-/* ── Advanced ── */
-
-static const ManualSection advanced_sections[] = {
-    {"Permissions",
-     "Claude asks before using\n"
-     "tools like Bash or Write.\n\n"
-     "Settings hierarchy:\n"
-     " 1. Project .claude/\n"
-     "    settings.json\n"
-     " 2. User ~/.claude/\n"
-     "    settings.json\n"
-     " 3. Defaults\n\n"
-     "In settings.json:\n"
-     " \"allowedTools\": [...]\n"
-     " \"deniedTools\":  [...]\n\n"
-     "/permissions to view\n"
-     "current session rules.\n"},
-
-    {"MCP Servers",
-     "MCP = Model Context\n"
-     "Protocol. Connect external\n"
-     "tools to Claude Code.\n\n"
-     "Examples:\n"
-     " Database queries\n"
-     " API integrations\n"
-     " Custom data sources\n\n"
-     "Setup:\n"
-     " /mcp to manage servers\n"
-     " Configure in settings\n"
-     " or .claude/settings\n\n"
-     "MCP servers run as local\n"
-     "processes Claude can call\n"
-     "like built-in tools.\n"},
-
-    {"Hooks",
-     "Hooks run your scripts\n"
-     "before/after Claude acts.\n\n"
-     "Types:\n"
-     " PreToolUse  before tool\n"
-     " PostToolUse after tool\n\n"
-     "Config in settings.json:\n"
-     " \"hooks\": {\n"
-     "   \"PreToolUse\": [{\n"
-     "     \"command\": \"./lint\"\n"
-     "   }]\n"
-     " }\n\n"
-     "Use cases:\n"
-     " Auto-lint on file save\n"
-     " Run tests after edit\n"
-     " Enforce code standards\n"},
-
-    {"Extended Thinking",
-     "Claude can think deeply\n"
-     "before responding.\n\n"
-     "When active, Claude uses\n"
-     "extra tokens reasoning\n"
-     "through hard problems.\n\n"
-     "Enable:\n"
-     " Type \"think\" in prompt\n"
-     " or toggle via /model\n\n"
-     "Best for:\n"
-     " Complex architecture\n"
-     " Multi-step debugging\n"
-     " Tricky logic problems\n\n"
-     "Uses more tokens but\n"
-     "improves output quality.\n"},
-};
+#define MACRO_MAX_COUNT 10
+#define MACRO_MAX_LEN 32
+#define MACROS_PATH APP_DATA_PATH("macros.txt") /* the original single set */
+#define MACROS_DIR APP_DATA_PATH("macros")
+#define MACRO_INDEX_PATH APP_DATA_PATH("macros.idx")
+#define MACRO_SET_MAX 12
+#define MACRO_SET_NAME_LEN 12
+#define MACRO_USE_PATH APP_DATA_PATH("macros.use")
+#define MACRO_USE_MAX 64
+#define MACRO_PIN_PATH APP_DATA_PATH("pins.txt")
+#define MACRO_PIN_MAX 3
+#define MACRO_PIN_FILE_MAX (MACRO_PIN_MAX * (MACRO_MAX_LEN + 1)) /* pins.txt, one line per pin */
+#define MACRO_RECHECK_TICKS 5000 /* while Macros is open */
+
+#define KEYMAPS_DIR APP_DATA_PATH("keymaps")
+#define KEYMAP_MAX 8 /* built-in profile + up to 7 from SD */
+#define KEYMAP_NAME_LEN 12
+#define KEYMAP_TEXT_LEN 256 /* typed-text actions of one profile */
+#define KEYMAP_FILE_MAX 2048
+
+#define STATS_PATH APP_DATA_PATH("stats.txt")
+#define STATS_BUCKET_COUNT 8
+
+/* press → release delay per link; settings can override it with the
+ * value suggested by the RTT probe */
+#ifdef HID_TRANSPORT_MOCK
+#define USB_HOLD_MS 0 /* nothing on the other end to wait for */
+#else
+#define USB_HOLD_MS 50
+#endif
+#define BLE_HOLD_MS 150
+#define HOLD_MIN_MS 8
+#define HOLD_MAX_MS 250
 
-/* ── Headless & CI ── */
-
-static const ManualSection headless_sections[] = {
-    {"Headless Mode",
-     "Run Claude without chat:\n"
-     " claude -p \"your query\"\n\n"
-     "Pipe input:\n"
-     " cat file | claude -p\n"
-     "   \"review this code\"\n\n"
-     "JSON output:\n"
-     " claude -p \"query\"\n"
-     "   --output-format json\n\n"
-     "Returns structured result\n"
-     "for scripting.\n\n"
-     "No interactive prompts.\n"
-     "No approval needed for\n"
-     "read-only operations.\n"},
-
-    {"CI Integration",
-     "Use Claude in CI:\n\n"
-     " claude -p \"review PR\"\n"
-     "   --no-input\n\n"
-     "Key flags:\n"
-     " -p         print mode\n"
-     " --no-input no prompts\n"
-     " --model    pick model\n"
-     " --output-format json\n\n"
-     "Set ANTHROPIC_API_KEY in\n"
-     "CI environment variables.\n\n"
-     "Exit codes:\n"
-     " 0 = success\n"
-     " 1 = error\n\n"
-     "Great for automated review\n"
-     "and code generation.\n"},
-
-    {"Model Selection",
-     "Switch models anytime:\n"
-     " /model in chat\n"
-     " --model flag at launch\n\n"
-     "Available models:\n\n"
-     " Opus (most capable)\n"
-     "  Best reasoning\n"
-     "  Highest cost\n\n"
-     " Sonnet (balanced)\n"
-     "  Good speed + quality\n"
-     "  Default model\n\n"
-     " Haiku (fastest)\n"
-     "  Quick responses\n"
-     "  Lowest cost\n\n"
-     "Pick based on task\n"
-     "complexity and budget.\n"},
-};
+#define HOSTS_PATH APP_DATA_PATH("hosts.txt")
+#define HOST_SLOT_COUNT 4
+#define HOST_NAME_LEN 10
+#define HOST_READY_SHOW_TICKS 3000 /* how long "Ready" stays in the header */
+
+/* ── Search index (generated) ── */
 
-/* ── Category index ── */
+#include "manual_index.h"
+_Static_assert(
+    SEARCH_QUIZ_COUNT == QUIZ_CARD_COUNT,
+    "manual_index.h is stale, run tools/gen_search_index.py");
 
-static const ManualCategory categories[] = {
-    {"Getting Started", setup_sections, 4},
-    {"Workspace", workspace_sections, 5},
-    {"Commands", commands_sections, 6},
-    {"Tools", tools_sections, 3},
-    {"Workflows", workflows_sections, 4},
-    {"Advanced", advanced_sections, 4},
-    {"Headless & CI", headless_sections, 3},
+/* ── Pre-wrapped layout (generated) ── */
+
+#include "manual_layout.h"
+_Static_assert(
+    LAYOUT_QUIZ_COUNT == QUIZ_CARD_COUNT &&
+        LAYOUT_FRAGMENT_COUNT == sizeof(manual_fragments) / sizeof(manual_fragments[0]),
+    "manual_layout.h is stale, run tools/gen_manual_layout.py");
+
+/* the reader's two line tables: FontSecondary, and the dense view's 4x6 font */
+typedef struct {
+    const LayoutLine* lines;
+    const uint8_t* skip;   /* per line, see manual_line_skip */
+    const uint16_t* first; /* per section, see manual_line_first */
+    uint8_t visible;       /* lines on screen */
+    uint8_t pitch;         /* px between baselines */
+    uint8_t top;           /* baseline of the first */
+} ReadLayout;
+
+static const ReadLayout read_layouts[2] = {
+    {manual_lines, manual_line_skip, manual_line_first, 4, 10, 24},
+    {manual_dense_lines, manual_dense_line_skip, manual_dense_line_first, 5, 7, 22},
 };
 
-#define CATEGORY_COUNT 7
-#define MENU_ITEM_COUNT (CATEGORY_COUNT + 1) /* +1 for Quiz */
+/* what the search picker steps through */
+static const char search_alphabet[] = "abcdefghijklmnopqrstuvwxyz0123456789";
 
-/* ── Settings & Macros constants ── */
+/* ── Stats (hidden page in Remote mode) ── */
 
-#define APP_DATA_DIR APP_DATA_PATH("")
-#define SETTINGS_PATH APP_DATA_PATH("settings.cfg")
-#define SETTINGS_COUNT 3
+/* upper bound (ms) of each histogram bucket; last bucket is open-ended */
+static const uint16_t stats_bucket_ms[STATS_BUCKET_COUNT - 1] = {10, 25, 50, 100, 200, 400, 800};
 
-#define MACRO_MAX_COUNT 10
-#define MACRO_MAX_LEN 32
-#define MACROS_PATH APP_DATA_PATH("macros.txt")
-
-/* ── Quiz cards ── */
-
-static const QuizCard quiz_cards[] = {
-    /* slash-command multi-choice */
-    {QuizTypeMultiChoice, "Show help and\navailable commands",
-     "/help", "/help", "/info", "/commands", 0},
-    {QuizTypeMultiChoice, "Clear conversation\nhistory",
-     "/clear", "/reset", "/clear", "/clean", 1},
-    {QuizTypeMultiChoice, "Summarize context to\nreduce token usage",
-     "/compact", "/shrink", "/summarize", "/compact", 2},
-    {QuizTypeMultiChoice, "Open configuration\nsettings editor",
-     "/config", "/config", "/setup", "/preferences", 0},
-    {QuizTypeMultiChoice, "Show token usage\nand session cost",
-     "/cost", "/usage", "/cost", "/tokens", 1},
-    {QuizTypeMultiChoice, "Diagnose setup issues\nand check API",
-     "/doctor", "/debug", "/check", "/doctor", 2},
-    {QuizTypeMultiChoice, "Create CLAUDE.md\nfor your project",
-     "/init", "/init", "/create", "/new", 0},
-    {QuizTypeMultiChoice, "Review PR or\ncode changes",
-     "/review", "/diff", "/review", "/inspect", 1},
-    {QuizTypeMultiChoice, "Fix terminal display\nand rendering",
-     "/terminal-setup", "/fix-term", "/display", "/terminal-setup", 2},
-    {QuizTypeMultiChoice, "Start a brand new\nsession from scratch",
-     "claude --new", "--new", "--fresh", "--reset", 0},
-    {QuizTypeMultiChoice, "Resume your previous\nconversation",
-     "claude --continue", "--resume", "--continue", "--last", 1},
-    {QuizTypeMultiChoice, "Run a one-shot query\nwithout chat mode",
-     "claude -p \"query\"", "-q", "-e", "-p", 2},
-    {QuizTypeMultiChoice, "Switch AI model\nduring a chat session",
-     "/model", "/model", "/switch", "/engine", 0},
-    {QuizTypeMultiChoice, "Edit your project's\nCLAUDE.md memory file",
-     "/memory", "/memo", "/memory", "/notes", 1},
-    {QuizTypeMultiChoice, "Undo to a previous\npoint in conversation",
-     "/rewind", "/back", "/undo", "/rewind", 2},
-    {QuizTypeMultiChoice, "Generate commit msg\nand commit changes",
-     "/commit", "/commit", "/save", "/push", 0},
-
-    /* concept multi-choice */
-    {QuizTypeMultiChoice, "Where do Skills\nfiles live?",
-     ".claude/skills/",
-     ".claude/skills/", "CLAUDE.md", "~/.config/claude/", 0},
-    {QuizTypeMultiChoice, "Which model is the\ndefault for Claude?",
-     "Sonnet",
-     "Opus", "Sonnet", "Haiku", 1},
-    {QuizTypeMultiChoice, "What does the -p\nflag do?",
-     "Print mode (no chat)",
-     "Print mode", "Profile mode", "Plugin mode", 0},
-    {QuizTypeMultiChoice, "Settings hierarchy\nhighest priority?",
-     "Project settings",
-     "Project", "User", "Default", 0},
-    {QuizTypeMultiChoice, "What is MCP?",
-     "Model Context Protocol",
-     "Model Context", "Manual Command", "Memory Cache", 0},
-    {QuizTypeMultiChoice, "Which hook runs\nBEFORE a tool?",
-     "PreToolUse",
-     "PostToolUse", "PreToolUse", "OnToolUse", 1},
-    {QuizTypeMultiChoice, "How to get JSON\noutput from CLI?",
-     "--output-format json",
-     "--json", "--output-format", "--format=json", 1},
-    {QuizTypeMultiChoice, "Ctrl+C in Claude\nCode does what?",
-     "Cancel/interrupt",
-     "Copy text", "Cancel/interrupt", "Clear screen", 1},
-};
+typedef struct {
+    uint32_t count;
+    uint32_t total_ms;
+    uint32_t max_ms;
+    uint32_t buckets[STATS_BUCKET_COUNT];
+} LatencyHist;
 
-#define QUIZ_CARD_COUNT 24
+typedef struct {
+    uint32_t presses; /* d-pad presses handled in Remote mode */
+    uint32_t drops;   /* input events lost because the intake ring was full */
+    uint32_t reports; /* HID reports sent (press + release) */
+    uint32_t macros;  /* macro strings typed */
+    uint32_t bytes;   /* characters typed by macros */
+    LatencyHist press_to_send; /* button event -> first report (includes double-click wait) */
+    LatencyHist send_time;     /* press report -> release report done */
+    LatencyHist rtt;           /* lock key press -> host LED report over USB, see rtt_tick() */
+} AppStats;
+
+/* ── Cycle profiling (add "PROFILE_CYCLES" to cdefines in application.fam) ── */
+
+#ifdef PROFILE_CYCLES
+typedef enum {
+    ProfRegionDraw,    /* draw_callback, GUI thread */
+    ProfRegionInputCb, /* input_callback, input service thread */
+    ProfRegionInput,   /* per-mode input handler, includes any HID send it triggers */
+    ProfRegionHidPress,
+    ProfRegionHidRelease,
+    ProfRegionCount,
+} ProfRegion;
 
-/* ── App state ── */
+typedef struct {
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t total;
+} ProfStat;
+
+typedef struct {
+    ProfRegion region;
+    uint32_t start;
+} ProfScope;
+
+static const char* const prof_region_names[ProfRegionCount] = {
+    "draw", "input_cb", "input", "hid_press", "hid_release"};
+
+/* each region is only entered from one thread, so no locking */
+static ProfStat prof_stats[ProfRegionCount];
+
+static inline void prof_scope_end(ProfScope* scope) {
+    uint32_t cycles = DWT->CYCCNT - scope->start;
+    ProfStat* stat = &prof_stats[scope->region];
+    if(stat->count == 0 || cycles < stat->min) stat->min = cycles;
+    if(cycles > stat->max) stat->max = cycles;
+    stat->total += cycles;
+    stat->count++;
+}
+
+/* accumulates the DWT cycle count until the end of the enclosing block */
+#define PROF_SCOPE(r) \
+    ProfScope _prof_scope __attribute__((cleanup(prof_scope_end))) = {(r), DWT->CYCCNT}
+
+static void prof_init(void) {
+    /* firmware normally has the cycle counter running already */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    memset(prof_stats, 0, sizeof(prof_stats));
+}
+
+static void prof_log(void) {
+    for(int r = 0; r < ProfRegionCount; r++) {
+        const ProfStat* stat = &prof_stats[r];
+        if(stat->count == 0) continue;
+        FURI_LOG_I(TAG, "prof %s: n=%lu min=%lu avg=%lu max=%lu cyc",
+                   prof_region_names[r],
+                   (unsigned long)stat->count,
+                   (unsigned long)stat->min,
+                   (unsigned long)(stat->total / stat->count),
+                   (unsigned long)stat->max);
+    }
+}
+
+#define PROF_LOG_INTERVAL_TICKS 10000
+#else
+#define PROF_SCOPE(r) do { } while(0)
+#endif
+
+/* ── Memory diagnostics (add "DIAG_MEMORY" to cdefines in application.fam) ── */
+
+#ifdef DIAG_MEMORY
+#define DIAG_PAINT_BYTE 0xA5
+#define DIAG_PAINT_MAX 1024 /* bytes painted below draw_callback's frame */
+#define DIAG_PAINT_SKIP 64  /* leave diag_stack_paint's own frame alone */
+
+typedef enum {
+    DiagScreenSplash,
+    DiagScreenHome,
+    DiagScreenRemote,
+    DiagScreenStats,
+    DiagScreenCategories,
+    DiagScreenSections,
+    DiagScreenRead,
+    DiagScreenQuiz,
+    DiagScreenSearch,
+    DiagScreenSettings,
+    DiagScreenMacros,
+#ifndef HID_TRANSPORT_BLE
+    DiagScreenBlePromo,
+#endif
+    DiagScreenCount,
+} DiagScreen;
+_Static_assert(
+    ManualViewSearch - ManualViewCategories == DiagScreenSearch - DiagScreenCategories,
+    "DiagScreen must list the manual views in ManualView order");
+
+/* written by the main thread and by draw_callback, read by both: atomics
+ * rather than a lock, since the GUI thread never waits on the main loop */
+typedef struct {
+    uint32_t main_stack_size;    /* the app thread's, as the loader created it; set before drawing */
+    atomic_uint main_stack_free; /* main thread high-watermark: min free bytes ever */
+    atomic_uint gui_stack_free;  /* same, for the GUI thread that runs draw_callback */
+    atomic_uint draw_stack_max;  /* deepest draw_callback frame seen, in bytes */
+    atomic_uint screens_seen;    /* bit per DiagScreen */
+    atomic_size_t heap_app;      /* heap owned by the app thread */
+    atomic_size_t heap_free;
+    atomic_size_t heap_min_free;
+    bool reported;               /* main thread only: full report logged once every screen was drawn */
+} DiagMemory;
+
+/* what the Memory page shows, read out of DiagMemory at publish */
+typedef struct {
+    uint32_t main_stack_used;
+    uint32_t draw_stack_max;
+    uint32_t gui_stack_free;
+    uint32_t heap_app;
+    uint32_t heap_free;
+    uint32_t heap_min_free;
+    uint32_t screens_seen;
+} DiagCounts;
+#endif
+
+typedef enum {
+    LedOff,
+    LedOrange,
+    LedBlue,
+    LedGreen,
+} LedColor;
+
+typedef enum {
+    HapticNone,
+    HapticSingle,
+    HapticDouble,
+} Haptic;
+
+#define HAPTIC_GAP_TICKS 150 /* pulses closer than this merge into one */
+
+/* what the LED shows and the haptic pulse still to play; main loop only */
+typedef struct {
+    uint8_t led;          /* LedColor last sent */
+    uint8_t haptic;       /* Haptic waiting for notify_flush() */
+    uint32_t haptic_tick; /* last pulse played */
+} NotifyState;
+
+typedef enum {
+    ScrollModePage,  /* Page Up / Page Down keys */
+    ScrollModeWheel, /* HID mouse wheel ticks */
+} ScrollMode;
+
+typedef enum {
+    StatsPageCounters,
+    StatsPageRtt,
+#ifdef PROFILE_CYCLES
+    StatsPageProfile,
+#endif
+#ifdef DIAG_MEMORY
+    StatsPageMemory,
+#endif
+    StatsPageCount,
+} StatsPage;
+
+/* the RTT probe, one step per main loop pass, see rtt_tick() */
+typedef enum {
+    RttIdle,
+    RttHeld,    /* lock key down, waiting for the host's LED report */
+    RttGap,     /* released, letting the host see it */
+    RttRestore, /* lock key down again to put the LED back where it was */
+} RttPhase;
+
+typedef struct {
+    uint8_t phase; /* RttPhase */
+    uint8_t toggles;  /* timed toggles done this run */
+    uint8_t lost;     /* of those, how many saw no LED report */
+    uint8_t presses;  /* lock key presses sent this run, restores included */
+    uint8_t origin;   /* LED byte when the run started */
+    uint8_t before;   /* LED byte before the current press */
+    bool seen;        /* the last press got its LED report */
+    bool restored;    /* the restore toggle already ran for this sample */
+    bool abort;       /* Back: finish the current toggle, restore, stop */
+    uint32_t tick;    /* of the press, or of the release during RttGap */
+} RttProbe;
+
+/* ── Gesture engine types (remote mode) ── */
+
+#define TAP_WINDOW_MS 300 /* multi-tap window, Settings → Taps */
+#define TAP_WINDOW_MIN_MS 150
+#define TAP_WINDOW_MAX_MS 600
+static const uint16_t tap_window_steps[] = {200, 300, 450}; /* what Settings cycles through */
+#define ACTION_KEYS_MAX 3
+#define ACTION_LABEL_LEN 8
+#define ACTION_KEY_GAP_MS 30 /* between the reports of a multi-key action */
+
+typedef enum {
+    GestureSingle,
+    GestureDouble,
+    GestureTriple,
+    GestureLong,
+    GestureChord, /* pressed while Back is held */
+    GestureCount,
+} Gesture;
+
+typedef enum {
+    ActionNone,
+    ActionKeys,       /* codes[] in order, KEY_MOD_* bits included */
+    ActionConsumer,   /* codes[0] is a consumer usage */
+    ActionText,       /* text typed, then Enter */
+    ActionHome,
+    ActionStats,
+    ActionScrollUp,   /* until released, see scroll_step() */
+    ActionScrollDown,
+    ActionOutputNext, /* BLE app: USB → BT → USB+BT */
+    ActionHostNext,   /* BLE app: next host slot */
+    ActionKeymapNext, /* next keymap profile */
+    ActionPin,        /* pinned macro number count, see macro_pin() */
+} ActionKind;
+
+typedef struct {
+    uint8_t kind; /* ActionKind */
+    uint8_t count;
+    uint16_t codes[ACTION_KEYS_MAX];
+    const char* text;
+    char label[ACTION_LABEL_LEN + 1];
+} GestureAction;
+
+/* what every (key, gesture) does, resolved for the current OS */
+typedef struct {
+    GestureAction actions[InputKeyMAX][GestureCount];
+    uint8_t max_taps[InputKeyMAX]; /* 1-3: a key fires as soon as it reaches this many taps */
+    char text[KEYMAP_TEXT_LEN];    /* ActionText strings of a profile loaded from SD */
+} Keymap;
+
+/* tap counting per key; only one key has taps waiting at a time, a
+ * different key flushes it first so keys go out in the order pressed */
+typedef struct {
+    uint8_t taps[InputKeyMAX];
+    uint32_t first_tick[InputKeyMAX]; /* first tap, for press → send latency */
+    uint32_t last_tick[InputKeyMAX];
+    InputKey pending; /* InputKeyMAX when nothing is waiting */
+    uint16_t tap_ms;
+    bool back_held;
+    bool back_long; /* Back's long press fires on release, unless it became a chord */
+    bool chorded;   /* a chord fired during this Back hold */
+} GestureState;
+
+/* ── Input intake ring (input service thread → main loop) ── */
+
+#define INPUT_RING_SIZE 32 /* power of two */
+/* slots only a Release may take, one per key, so a full ring never loses the end of a hold */
+#define INPUT_RING_RESERVE InputKeyMAX
+#define APP_FLAG_INPUT (1UL << 0)
+
+/* one input event as seen by the handlers; Repeat events for a key that
+ * already has a Repeat waiting are folded into it as extra repeats */
+typedef struct {
+    InputKey key;
+    InputType type;
+    uint8_t repeats;
+} InputRecord;
+
+/* single producer (input_callback), single consumer (main loop) */
+typedef struct {
+    InputRecord slots[INPUT_RING_SIZE];
+    atomic_uint head; /* next slot the producer writes */
+    atomic_uint tail; /* next slot the consumer reads */
+    atomic_uint repeat_pending[InputKeyMAX]; /* Repeats since the queued one was popped */
+    atomic_uint release_lost; /* bit per key: a Release found even the reserve full */
+    uint32_t release_due;     /* consumer side: lost Releases still to hand out */
+    atomic_uint dropped;
+    atomic_uint coalesced;
+    FuriThreadId consumer;
+} InputRing;
+
+/* ── Link state (USB/BT callbacks → main loop) ── */
+
+#define APP_FLAG_LINK (1UL << 1)
+
+typedef enum {
+    LinkUsb,
+    LinkBle,
+    LinkCount,
+} LinkId;
+
+/* written only from the USB/BT callbacks, read by the main loop on APP_FLAG_LINK */
+typedef struct {
+    atomic_bool up[LinkCount];
+    atomic_uint changed_tick[LinkCount]; /* tick of the last connect/disconnect */
+    FuriThreadId consumer;
+} LinkState;
+
+/* ── Storage worker (main loop ↔ SD I/O thread) ── */
+
+#define APP_FLAG_STORAGE (1UL << 2)
+#define STORAGE_QUEUE_LEN 8
+#define STORAGE_PATH_LEN 72
+#define STORAGE_INLINE_MAX 64 /* write payloads travel inside the job */
+
+typedef enum {
+    StorageJobRead,  /* path, offset, size → buf */
+    StorageJobWrite, /* data[size], or buf[size] if set (freed once written) → path,
+                      * replacing it; a tag asks for a completion saying whether
+                      * the file reads back the same */
+    StorageJobRemove, /* delete path */
+    StorageJobPatch, /* data[size] → path at offset, if the file exists */
+    StorageJobRecord, /* the StorageRecord at offset, then its record → buf */
+    StorageJobMacroIndex, /* refresh the macro set index into buf */
+    StorageJobQuizScan, /* pick a round from the boxes file at path into buf */
+    StorageJobStop,  /* after everything queued before it */
+} StorageJobKind;
+
+/* echoed in the completion so the main loop knows what arrived */
+typedef enum {
+    StorageTagNone,
+    StorageTagMacros,
+    StorageTagMacroIndex,
+    StorageTagMacroUse,
+    StorageTagMacroPins,
+    StorageTagKeymap,
+    StorageTagQuizBank,
+    StorageTagQuizCard,
+    StorageTagQuizScan,
+    StorageTagSettings,
+} StorageTag;
+
+typedef struct {
+    uint8_t kind; /* StorageJobKind */
+    uint8_t tag;  /* StorageTag */
+    uint8_t arg;  /* caller's, echoed back */
+    uint16_t size;
+    uint32_t offset;
+    void* buf;    /* StorageJobRead: the caller's until the completion arrives */
+    char path[STORAGE_PATH_LEN];
+    uint8_t data[STORAGE_INLINE_MAX];
+} StorageJob;
+
+typedef struct {
+    uint8_t tag;
+    uint8_t arg;
+    bool ok;
+    uint16_t bytes;
+    void* buf;
+} StorageDone;
+
+/* one entry of a fixed-size record table, so entry i is at a known offset */
+typedef struct {
+    uint32_t offset;
+    uint16_t size;
+    uint16_t reserved;
+} StorageRecord;
+
+/* one macro file: where its entries are, and what the file looked like when indexed */
+typedef struct {
+    char name[MACRO_SET_NAME_LEN + 1];
+    bool root;      /* MACROS_PATH rather than MACROS_DIR/<name>.txt */
+    uint8_t count;  /* entries, up to MACRO_MAX_COUNT */
+    uint32_t size;
+    uint32_t mtime;
+    uint16_t offsets[MACRO_MAX_COUNT + 1]; /* start of each entry; [count] is where the last one ends */
+} MacroSetInfo;
+
+/* cached in macros.idx so unchanged files are not re-scanned */
+#define MACRO_INDEX_MAGIC 0x58494D43U /* "CMIX" */
+#define MACRO_INDEX_VERSION 1
+
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint8_t count;
+    MacroSetInfo sets[MACRO_SET_MAX];
+} MacroIndex;
+
+/* macros.use: how often and how recently each macro was sent, keyed by an
+ * FNV-1a hash of its text so it survives reordering and set switches.
+ * Recency counts sends, not time: last is the value of seq at that send. */
+#define MACRO_USE_MAGIC 0x45534D43U /* "CMSE" */
+#define MACRO_USE_VERSION 1
+
+typedef enum {
+    MacroSortUsage, /* frecency, see macro_use_score() */
+    MacroSortFile,
+} MacroSort;
+
+typedef struct {
+    uint32_t hash;
+    uint32_t last;
+    uint16_t count;
+    uint16_t reserved;
+} MacroUse;
+
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t reserved;
+    uint32_t seq; /* sends so far */
+    MacroUse uses[MACRO_USE_MAX];
+} MacroUseFile;
+
+/* quiz.bank, written by tools/gen_quiz_bank.py: a QuizBankHeader, count
+ * StorageRecord entries, then the records. A record is a QuizRecordHead,
+ * line_count LayoutLines for its question, and the question, answer and
+ * three options as NUL-terminated strings. */
+#define QUIZ_BANK_MAGIC 0x4B4E4251U /* "QBNK" */
+#define QUIZ_BANK_VERSION 2
+
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t reserved;
+    uint32_t count;
+    uint32_t id; /* FNV-1a of the records: a rebuilt bank is a new card set */
+} QuizBankHeader;
+
+typedef struct {
+    uint8_t correct_option;
+    uint8_t line_count;
+    uint16_t reserved;
+} QuizRecordHead;
+
+/* quiz.boxes and quiz.bank.boxes: Leitner boxes, a QuizBoxHeader and then
+ * one QuizBox per card, so an answer is saved by patching its 4 bytes.
+ * Due counts rounds, not time: a card is due once round reaches due. */
+#define QUIZ_BOXES_MAGIC 0x58424251U /* "QBBX" */
+#define QUIZ_BOXES_VERSION 1
+
+typedef enum {
+    QuizResultNone,
+    QuizResultRight,
+    QuizResultWrong,
+} QuizResult;
+
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t round; /* rounds started so far */
+    uint32_t source; /* id of the card set; another set's file is started over */
+    uint32_t count;
+} QuizBoxHeader;
+
+typedef struct {
+    uint16_t due;  /* round it comes back in */
+    uint8_t box;   /* 0 = never asked, then 1..QUIZ_BOX_MAX */
+    uint8_t last;  /* QuizResult */
+} QuizBox;
+
+/* a round picked on the worker, see quiz_scan_run() */
+typedef struct {
+    uint32_t source; /* in */
+    uint16_t total;  /* in: cards in the set */
+    uint8_t want;    /* in: round size, at most total */
+    uint8_t count;   /* out: cards picked */
+    uint16_t round;  /* out: the round this is */
+    uint16_t ids[QUIZ_ROUND_MAX];
+    QuizBox boxes[QUIZ_ROUND_MAX];
+    uint32_t keys[QUIZ_ROUND_MAX]; /* rank << 24 | random, ascending */
+} QuizScan;
+
+/* jobs run in order on the worker; reads post a StorageDone and set APP_FLAG_STORAGE */
+typedef struct {
+    FuriThread* thread;
+    FuriMessageQueue* jobs;
+    FuriMessageQueue* done;
+    FuriThreadId consumer;
+} StorageWorker;
+
+#ifdef HID_TRANSPORT_BLE
+/* where keys go, picked on the Home screen: a bit per LinkId */
+typedef enum {
+    HidOutputUsb = 1U << LinkUsb,
+    HidOutputBle = 1U << LinkBle,
+    HidOutputBoth = HidOutputUsb | HidOutputBle, /* every report fanned out to both */
+} HidOutput;
+#endif
 
+/* ── Render snapshot (main loop → draw_callback) ── */
+
+#define MACRO_VISIBLE_LINES 3
+#define RENDER_FRONT 1U                /* ctrl bit 0: index of the published buffer */
+#define RENDER_BUSY(i) (2U << (i))     /* ctrl bits 1-2: draw_callback is reading buf[i] */
+#define RENDER_RETRY_TICKS 10          /* publish skipped while a frame was in flight */
+
+/* Everything the draw functions read. The main loop fills the back buffer
+ * and flips RENDER_FRONT; draw_callback marks the front buffer busy while
+ * it draws, so neither side ever waits on the other. Strings are copied in
+ * too: nothing here points back into the app state. */
 typedef struct {
     AppMode mode;
+    ManualView manual_view;
+    bool manual_dense;
     bool hid_connected;
-    FuriMutex* mutex;
+    bool link_up[LinkCount];
+#ifdef HID_TRANSPORT_BLE
+    uint8_t output;
+    char host_name[HOST_NAME_LEN + 1];
+    bool host_switching;
+    uint32_t host_switch_tick;
+    uint32_t host_ready_tick;
+    uint32_t host_ready_ms;
+#endif
+    uint32_t link_since;
+    uint32_t flash_tick;
+    char flash_label[MACRO_MAX_LEN + 1]; /* empty: nothing flashed yet */
+
+    uint8_t cat_index;
+    uint8_t section_index;
+    int16_t scroll_offset;
+
+    bool quiz_ready; /* the current card is loaded and copied below */
+    char quiz_question[QUIZ_QUESTION_LINES][48];
+    char quiz_answer[32];
+    char quiz_options[3][32];
+    uint8_t quiz_correct_option;
+    uint16_t quiz_bank_count;
+    uint8_t quiz_index;
+    uint8_t quiz_count;
+    uint8_t quiz_correct;
+    uint8_t quiz_total;
+    uint8_t quiz_streak;
+    uint8_t quiz_best_streak;
+    int8_t quiz_selected;
+    bool quiz_answered;
+    bool quiz_selecting;
+
+    char search_query[SEARCH_QUERY_MAX + 1];
+    uint8_t search_char;
+    uint16_t search_hits[SEARCH_HIT_MAX];
+    uint8_t search_hit_count;
+    uint8_t search_hit_index;
+    bool search_in_hits;
+
+    bool stats_visible;
+    uint8_t stats_page;
+    uint8_t rtt_phase;
+    uint8_t rtt_toggles;
+    AppStats stats;
+    uint16_t hold_ms[LinkCount];
+#ifdef HID_TRANSPORT_BLE
+    uint8_t host_slot;
+    uint8_t host_count;
+    char host_names[HOST_SLOT_COUNT][HOST_NAME_LEN + 1];
+#endif
+#ifdef DIAG_MEMORY
+    DiagCounts diag;
+#endif
+#ifdef PROFILE_CYCLES
+    ProfStat prof[ProfRegionCount];
+#endif
+
+    bool haptics_enabled;
+    bool led_enabled;
+    uint8_t os_mode;
+    uint8_t scroll_mode;
+    uint16_t tap_ms;
+    uint8_t macro_sort;
+    uint8_t settings_index;
+
+    uint8_t macro_count;
+    uint8_t macro_index;
+    bool macros_loading;
+    uint8_t macro_set_count;
+    char macro_set_name[MACRO_SET_NAME_LEN + 1];
+    uint8_t macro_first; /* first visible line */
+    bool macro_pin_hint;
+    char macro_lines[MACRO_VISIBLE_LINES][MACRO_MAX_LEN + 1];
+    char pin_rows[MACRO_PIN_MAX][MACRO_MAX_LEN + 8]; /* Remote: "B+OK /clear" */
+} RenderSnapshot;
+
+typedef struct {
+    RenderSnapshot buf[2];
+    atomic_uint ctrl;
+    bool dirty; /* main loop only: last publish was skipped */
+#ifdef DIAG_MEMORY
+    DiagMemory* diag; /* draw_callback records its own stack use here */
+#endif
+} RenderState;
+
+/* ── App state ── */
+
+typedef struct {
+    AppMode mode;
+    bool hid_connected;   /* a selected link is up — refreshed by link_refresh() */
+    bool link_up[LinkCount];
+    uint32_t link_since;  /* tick a selected link last changed state */
+    LinkState link;
+    RenderState render;
+    InputRing intake;
+    StorageWorker io;
     NotificationApp* notifications;
+    NotifyState notify;
 
 #ifdef HID_TRANSPORT_BLE
-    bool use_ble;
-    bool ble_connected;
+    uint8_t output; /* HidOutput, see hid_select() */
     Bt* bt;
     FuriHalBleProfileBase* ble_profile;
+    void* transport_ctx[LinkCount];
+
+    /* BLE host slots: each is its own bonded identity, see hid_host_switch() */
+    char host_names[HOST_SLOT_COUNT][HOST_NAME_LEN + 1];
+    uint8_t host_count;
+    uint8_t host_slot;
+    bool host_switching;       /* waiting for the new slot's host to connect */
+    uint32_t host_switch_tick;
+    uint32_t host_ready_tick;
+    uint32_t host_ready_ms;    /* switch → connected, for the header */
 #endif
     FuriHalUsbInterface* usb_prev;
+    bool usb_started;
+    uint16_t hold_ms[LinkCount]; /* press → release delay per link */
 
     /* manual navigation */
     ManualView manual_view;
+    bool manual_dense; /* reader draws manual_dense_lines in the 4x6 font, OK toggles */
     uint8_t cat_index;
     uint8_t section_index;
     int16_t scroll_offset;
 
+    /* manual search */
+    char search_query[SEARCH_QUERY_MAX + 1];
+    uint8_t search_len;
+    uint8_t search_char; /* search_alphabet[] index under the picker */
+    uint16_t search_hits[SEARCH_HIT_MAX]; /* postings, doc << 8 | line, in doc order */
+    uint8_t search_hit_count;
+    uint8_t search_hit_index;
+    bool search_in_hits; /* Up/Down move through hits rather than the picker */
+    bool search_opened;  /* the reader or quiz was opened from a hit; Back returns there */
+
     /* quiz */
     uint8_t quiz_index;
     uint8_t quiz_correct;
     uint8_t quiz_total;
     uint8_t quiz_streak;
     uint8_t quiz_best_streak;
-    uint8_t quiz_order[24]; /* QUIZ_CARD_COUNT — shuffled indices */
+    uint16_t quiz_order[QUIZ_ROUND_MAX]; /* this round's card ids, in asking order */
     int8_t  quiz_selected;  /* multi-choice: -1=none, 0/1/2 */
     bool    quiz_answered;  /* multi-choice: showing feedback */
     bool    quiz_selecting; /* showing difficulty picker */
     uint8_t quiz_count;     /* questions this round (8/16/24) */
-
-    /* double-click detection (remote mode) */
-    InputKey dc_key;
-    uint32_t dc_tick;
-    bool dc_pending;
+    bool    quiz_from_bank; /* the ids are quiz.bank records, not quiz_cards[] */
+    uint8_t quiz_seq;       /* bumped per round, so a late scan for an old one is dropped */
+    bool    quiz_scanning;  /* the round's cards are still being picked */
+    bool    quiz_scan_pending;
+    QuizScan quiz_scan;     /* the worker's while quiz_scan_pending */
+    bool    quiz_start_queued; /* quiz_start() waits for the pending scan */
+    QuizBox quiz_boxes[QUIZ_ROUND_MAX]; /* each picked card's box, in quiz_order */
+    bool    quiz_boxes_ready; /* the round is scheduled; answers update the boxes file */
+    uint16_t quiz_round;
+    uint16_t quiz_bank_count; /* records in quiz.bank; 0 = built-in cards only */
+    uint32_t quiz_bank_id;
+    QuizBankHeader quiz_bank_head; /* the worker's until StorageTagQuizBank arrives */
+    bool quiz_bank_pending;
+    uint32_t quiz_record[QUIZ_RECORD_MAX / 4]; /* the current bank card; the worker's while pending */
+    uint16_t quiz_record_id;
+    bool quiz_record_pending;
+    bool quiz_record_ready;
+    QuizCard quiz_bank_card; /* points into quiz_record */
+
+    /* gesture recognizer + dispatch table (remote mode) */
+    GestureState gesture;
+    Keymap keymaps[2]; /* the active one + the one the next profile is built into */
+    Keymap* keymap;
+    uint8_t keymap_want; /* profile asked for; keymap_index once it has loaded */
+    char keymap_names[KEYMAP_MAX][KEYMAP_NAME_LEN + 1]; /* [0] is the built-in profile */
+    uint8_t keymap_count;
+    uint8_t keymap_index;
+
+    /* hold-to-scroll (remote mode) */
+    int8_t scroll_dir; /* +1 up, -1 down, 0 idle */
+    uint8_t scroll_repeats;
 
     /* visual feedback flash */
     uint32_t flash_tick;
     const char* flash_label;
 
+    /* throughput counters + latency histograms */
+    AppStats stats;
+    bool stats_visible;
+    uint8_t stats_page; /* StatsPage, Left/Right on the stats page */
+    RttProbe rtt;
+#ifdef DIAG_MEMORY
+    DiagMemory diag;
+#endif
+
     /* splash screen */
     uint32_t splash_start;
 
@@ -741,114 +938,1085 @@ typedef struct {
     bool haptics_enabled;
     bool led_enabled;
     uint8_t os_mode; /* 0=Mac, 1=Windows, 2=Linux */
+    uint8_t scroll_mode; /* ScrollMode */
     uint8_t settings_index;
+    bool settings_dirty;    /* changed since settings.bin was last written */
+    uint32_t settings_tick; /* last change, for the write-behind idle flush */
+    bool settings_migrating; /* settings.cfg is removed once settings.bin verifies */
 
     /* macros */
     char macros[MACRO_MAX_COUNT][MACRO_MAX_LEN + 1];
     uint8_t macro_count;
     uint8_t macro_index;
-    bool macros_loaded;
+    bool macros_loading; /* set read queued on the storage worker, or the first index */
+    bool macro_reloading; /* that read replaces the current set after an edit */
+    char macro_io[512];  /* the worker reads the current set's entries into this */
+    MacroIndex macro_sets; /* replaced whole when a refreshed index arrives */
+    bool macro_sets_ready;
+    bool macro_index_pending;
+    uint32_t macro_check_tick; /* last index refresh request */
+    uint8_t macro_set;
+    char macro_set_name[MACRO_SET_NAME_LEN + 1]; /* saved in settings, matched once the index is in */
+    uint8_t macro_order[MACRO_MAX_COUNT]; /* list position → macros[] */
+    uint8_t macro_sort; /* MacroSort */
+    MacroUseFile macro_use; /* the worker's until StorageTagMacroUse arrives */
+    bool macro_use_ready;
+    bool macro_use_on_sd; /* macros.use exists at full size, so sends can patch it */
+    char macro_pins[MACRO_PIN_MAX][MACRO_MAX_LEN + 1]; /* "" = unpinned */
+    char pin_io[MACRO_PIN_FILE_MAX + 1]; /* pins.txt as read at launch; writes get their own copy */
+    bool macro_pin_hint; /* Macros footer shows the pin gesture until the next key */
 } ClaudeRemoteState;
 
 /* ── Utility ── */
 
-static uint16_t count_lines(const char* text) {
-    uint16_t count = 1;
-    for(const char* p = text; *p; p++) {
-        if(*p == '\n') count++;
+static uint16_t parse_u16(const char* p) {
+    uint32_t value = 0;
+    while(*p >= '0' && *p <= '9' && value <= UINT16_MAX) value = value * 10 + (*p++ - '0');
+    return value > UINT16_MAX ? UINT16_MAX : value;
+}
+
+/* sections are numbered in menu order in the generated tables */
+static uint8_t manual_section_id(uint8_t cat, uint8_t section) {
+    uint8_t id = section;
+    for(uint8_t c = 0; c < cat; c++) id += categories[c].section_count;
+    return id;
+}
+
+/* the next character of manual text, '\0' at the end; a byte of 0x80 or
+ * more stands for manual_fragments[byte - 0x80] */
+static char manual_next(ManualCursor* cursor) {
+    for(;;) {
+        if(cursor->fragment) {
+            if(*cursor->fragment) return *cursor->fragment++;
+            cursor->fragment = NULL;
+        }
+        uint8_t c = (uint8_t)*cursor->text;
+        if(c == 0) return '\0';
+        cursor->text++;
+        if(c < 0x80) return (char)c;
+        cursor->fragment = manual_fragments[c - 0x80];
     }
-    return count;
 }
 
-static void quiz_shuffle(ClaudeRemoteState* state) {
-    for(uint8_t i = 0; i < QUIZ_CARD_COUNT; i++) {
-        state->quiz_order[i] = i;
+/* a cursor at offset into text, skip characters into the fragment stored
+ * there; a layout line's start, so drawing never walks up to it */
+static ManualCursor manual_cursor_at(const char* text, uint16_t offset, uint8_t skip) {
+    ManualCursor cursor = {text + offset, NULL};
+    if(skip) cursor.fragment = manual_fragments[(uint8_t)*cursor.text++ - 0x80] + skip;
+    return cursor;
+}
+
+/* where a cursor into text is, ordered like manual_line_pos() */
+static uint32_t manual_cursor_pos(const ManualCursor* cursor, const char* text) {
+    if(cursor->fragment && *cursor->fragment) {
+        const char* mark = cursor->text - 1;
+        const char* fragment = manual_fragments[(uint8_t)*mark - 0x80];
+        return (uint32_t)(mark - text) << 8 | (uint32_t)(cursor->fragment - fragment);
     }
-    for(uint8_t i = QUIZ_CARD_COUNT - 1; i > 0; i--) {
-        uint8_t j = furi_hal_random_get() % (i + 1);
-        uint8_t tmp = state->quiz_order[i];
-        state->quiz_order[i] = state->quiz_order[j];
-        state->quiz_order[j] = tmp;
+    return (uint32_t)(cursor->text - text) << 8;
+}
+
+/* moves the cursor to the start of source line `line`; returns where that
+ * is, see manual_cursor_pos() */
+static uint32_t manual_seek_line(ManualCursor* cursor, uint8_t line) {
+    const char* text = cursor->text;
+    while(line) {
+        char c = manual_next(cursor);
+        if(c == '\0') break;
+        if(c == '\n') line--;
     }
+    return manual_cursor_pos(cursor, text);
 }
 
-/* ── Settings persistence ── */
+/* a layout line of text into buf; newlines inside it were joined prose.
+ * skip is manual_line_skip's entry for it, 0 for quiz lines */
+static void layout_line_text(
+    const char* text,
+    const LayoutLine* line,
+    uint8_t skip,
+    char* buf,
+    size_t size) {
+    ManualCursor cursor = manual_cursor_at(text, line->offset, skip);
+    size_t i = 0;
+    for(uint8_t n = 0; n < line->indent && i + 1 < size; n++) buf[i++] = ' ';
+    for(uint8_t n = 0; n < line->length && i + 1 < size; n++) {
+        char c = manual_next(&cursor);
+        buf[i++] = c == '\n' ? ' ' : c;
+    }
+    buf[i] = '\0';
+}
 
-static void load_settings(ClaudeRemoteState* state) {
-    state->haptics_enabled = true;
-    state->led_enabled = true;
-    state->os_mode = 0;
+/* the furthest the reader scrolls: the last lines fill the screen */
+static int16_t manual_max_scroll(const ReadLayout* layout, uint8_t id) {
+    int16_t lines = layout->first[id + 1] - layout->first[id];
+    return lines > layout->visible ? lines - layout->visible : 0;
+}
 
-    Storage* storage = furi_record_open(RECORD_STORAGE);
-    File* file = storage_file_alloc(storage);
+/* where layout line i starts, comparable with manual_cursor_pos() */
+static uint32_t manual_line_pos(const ReadLayout* layout, uint16_t i) {
+    return (uint32_t)layout->lines[i].offset << 8 | layout->skip[i];
+}
 
-    if(storage_file_open(file, SETTINGS_PATH, FSAM_READ, FSOM_OPEN_EXISTING)) {
-        char buf[64];
-        uint16_t bytes_read = storage_file_read(file, buf, sizeof(buf) - 1);
-        buf[bytes_read] = '\0';
-        storage_file_close(file);
+/* the scroll position that puts the line holding text position pos at the
+ * top, as far as the reader scrolls */
+static int16_t manual_scroll_to(const ReadLayout* layout, uint8_t id, uint32_t pos) {
+    int16_t row = 0;
+    while(layout->first[id] + row + 1 < layout->first[id + 1] &&
+          manual_line_pos(layout, layout->first[id] + row + 1) <= pos) {
+        row++;
+    }
+    int16_t max_scroll = manual_max_scroll(layout, id);
+    return row < max_scroll ? row : max_scroll;
+}
 
-        char* p = buf;
-        while(*p) {
-            if(strncmp(p, "haptics=", 8) == 0) {
-                state->haptics_enabled = (p[8] == '1');
-            } else if(strncmp(p, "led=", 4) == 0) {
-                state->led_enabled = (p[4] == '1');
-            } else if(strncmp(p, "os=", 3) == 0) {
-                if(p[3] == 'w') state->os_mode = 1;
-                else if(p[3] == 'l') state->os_mode = 2;
-                else state->os_mode = 0;
+/* Picks count of total card ids into quiz_order, uniformly and in random
+ * order; returns how many. For a round that can't follow the schedule.
+ * Floyd's sampling takes count draws however big the bank is. */
+static uint8_t quiz_sample(ClaudeRemoteState* state, uint8_t count, uint16_t total) {
+    if(count > QUIZ_ROUND_MAX) count = QUIZ_ROUND_MAX;
+    if(count > total) count = total;
+    uint8_t n = 0;
+    for(uint32_t j = total - count; j < total; j++) {
+        uint16_t pick = furi_hal_random_get() % (j + 1);
+        for(uint8_t i = 0; i < n; i++) {
+            if(state->quiz_order[i] == pick) {
+                pick = j;
+                break;
             }
-            while(*p && *p != '\n') p++;
-            if(*p == '\n') p++;
         }
+        state->quiz_order[n++] = pick;
+    }
+    /* the set is uniform but late ids land late; shuffle the order */
+    for(uint8_t i = n; i > 1; i--) {
+        uint8_t j = furi_hal_random_get() % i;
+        uint16_t tmp = state->quiz_order[i - 1];
+        state->quiz_order[i - 1] = state->quiz_order[j];
+        state->quiz_order[j] = tmp;
+    }
+    return n;
+}
+
+/* ── Manual search ── */
+
+/* first term not below query; every term it prefixes follows it */
+static uint16_t search_lower_bound(const char* query) {
+    uint16_t lo = 0, hi = SEARCH_TERM_COUNT;
+    while(lo < hi) {
+        uint16_t mid = (lo + hi) / 2;
+        if(strcmp(search_words + search_terms[mid].word, query) < 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+/* keeps hits sorted and unique; when full, the last in doc order go */
+static void search_hit_add(ClaudeRemoteState* state, uint16_t hit) {
+    uint8_t n = state->search_hit_count;
+    uint8_t i = n;
+    while(i > 0 && state->search_hits[i - 1] > hit) i--;
+    if((i > 0 && state->search_hits[i - 1] == hit) || i == SEARCH_HIT_MAX) return;
+    if(n == SEARCH_HIT_MAX) n--;
+    memmove(&state->search_hits[i + 1], &state->search_hits[i], (n - i) * sizeof(uint16_t));
+    state->search_hits[i] = hit;
+    state->search_hit_count = n + 1;
+}
+
+/* every line holding a word that starts with the query */
+static void search_run(ClaudeRemoteState* state) {
+    state->search_hit_count = 0;
+    state->search_hit_index = 0;
+    if(state->search_len == 0) return;
+    for(uint16_t t = search_lower_bound(state->search_query); t < SEARCH_TERM_COUNT; t++) {
+        if(strncmp(search_words + search_terms[t].word, state->search_query, state->search_len) != 0) {
+            break;
+        }
+        for(uint16_t p = search_terms[t].posting; p < search_terms[t + 1].posting; p++) {
+            search_hit_add(state, search_postings[p]);
+        }
+    }
+}
+
+/* docs number the sections in menu order; false means a quiz card */
+static bool search_doc_section(uint8_t doc, uint8_t* cat, uint8_t* section) {
+    for(uint8_t c = 0; c < CATEGORY_COUNT; c++) {
+        if(doc < categories[c].section_count) {
+            *cat = c;
+            *section = doc;
+            return true;
+        }
+        doc -= categories[c].section_count;
+    }
+    return false;
+}
+
+/* the hit's line, leading spaces dropped; a quiz card's question on one line */
+static void search_hit_text(uint16_t hit, char* buf, size_t size) {
+    uint8_t cat, section;
+    ManualCursor cursor = {NULL, NULL};
+    bool section_hit = search_doc_section(hit >> 8, &cat, &section);
+    if(section_hit) {
+        cursor.text = categories[cat].sections[section].content;
+        manual_seek_line(&cursor, hit & 0xFF);
     } else {
-        storage_file_close(file);
+        cursor.text = quiz_cards[(hit >> 8) - SEARCH_SECTION_COUNT].description;
+    }
+    char c = manual_next(&cursor);
+    while(c == ' ') c = manual_next(&cursor);
+    size_t i = 0;
+    for(; c && i + 1 < size; c = manual_next(&cursor)) {
+        if(c == '\n' && section_hit) break;
+        buf[i++] = c == '\n' ? ' ' : c;
     }
+    buf[i] = '\0';
+}
 
-    storage_file_free(file);
-    furi_record_close(RECORD_STORAGE);
+/* ── Stats helpers ── */
+
+static void stats_hist_add(LatencyHist* hist, uint32_t ms) {
+    uint8_t b = 0;
+    while(b < STATS_BUCKET_COUNT - 1 && ms > stats_bucket_ms[b]) b++;
+    hist->buckets[b]++;
+    hist->count++;
+    hist->total_ms += ms;
+    if(ms > hist->max_ms) hist->max_ms = ms;
 }
 
-static void save_settings(ClaudeRemoteState* state) {
+static uint32_t stats_hist_avg(const LatencyHist* hist) {
+    return hist->count ? hist->total_ms / hist->count : 0;
+}
+
+static void stats_write_hist(File* file, const char* name, const LatencyHist* hist) {
+    char buf[64];
+    int len = snprintf(buf, sizeof(buf), "%s: count=%lu avg=%lu max=%lu\n", name,
+                       (unsigned long)hist->count,
+                       (unsigned long)stats_hist_avg(hist),
+                       (unsigned long)hist->max_ms);
+    if(len > 0) storage_file_write(file, buf, len);
+    for(uint8_t b = 0; b < STATS_BUCKET_COUNT; b++) {
+        if(b < STATS_BUCKET_COUNT - 1) {
+            len = snprintf(buf, sizeof(buf), " <=%u:%lu", stats_bucket_ms[b],
+                           (unsigned long)hist->buckets[b]);
+        } else {
+            len = snprintf(buf, sizeof(buf), " >%u:%lu\n", stats_bucket_ms[b - 1],
+                           (unsigned long)hist->buckets[b]);
+        }
+        if(len > 0) storage_file_write(file, buf, len);
+    }
+}
+
+static void save_stats(ClaudeRemoteState* state) {
+    const AppStats* stats = &state->stats;
+    if(stats->presses == 0 && stats->reports == 0) return;
+
     Storage* storage = furi_record_open(RECORD_STORAGE);
     storage_simply_mkdir(storage, APP_DATA_DIR);
     File* file = storage_file_alloc(storage);
 
-    if(storage_file_open(file, SETTINGS_PATH, FSAM_WRITE, FSOM_CREATE_ALWAYS)) {
-        char buf[48];
-        int len = snprintf(buf, sizeof(buf), "haptics=%d\nled=%d\nos=%s\n",
-                           state->haptics_enabled ? 1 : 0,
-                           state->led_enabled ? 1 : 0,
-                           state->os_mode == 1 ? "win" : state->os_mode == 2 ? "linux" : "mac");
+    if(storage_file_open(file, STATS_PATH, FSAM_WRITE, FSOM_CREATE_ALWAYS)) {
+        char buf[64];
+        int len = snprintf(buf, sizeof(buf), "presses=%lu\nreports=%lu\nmacros=%lu\nbytes=%lu\n",
+                           (unsigned long)stats->presses,
+                           (unsigned long)stats->reports,
+                           (unsigned long)stats->macros,
+                           (unsigned long)stats->bytes);
         if(len > 0) storage_file_write(file, buf, len);
-        storage_file_close(file);
-    } else {
-        storage_file_close(file);
+        len = snprintf(buf, sizeof(buf), "input_drops=%lu\ninput_coalesced=%lu\n",
+                       (unsigned long)stats->drops,
+                       (unsigned long)atomic_load(&state->intake.coalesced));
+        if(len > 0) storage_file_write(file, buf, len);
+        stats_write_hist(file, "press_to_send_ms", &stats->press_to_send);
+        stats_write_hist(file, "send_ms", &stats->send_time);
+        if(stats->rtt.count) stats_write_hist(file, "rtt_usb_ms", &stats->rtt);
     }
 
+    storage_file_close(file);
     storage_file_free(file);
     furi_record_close(RECORD_STORAGE);
 }
 
-/* ── Macro helpers ── */
+/* ── Memory diagnostics helpers ── */
 
-static uint16_t char_to_hid(char c) {
-    if(c >= 'a' && c <= 'z') return HID_KEYBOARD_A + (c - 'a');
-    if(c >= 'A' && c <= 'Z') return (HID_KEYBOARD_A + (c - 'A')) | KEY_MOD_LEFT_SHIFT;
-    if(c >= '1' && c <= '9') return HID_KEYBOARD_1 + (c - '1');
-    if(c == '0') return HID_KEYBOARD_0;
-    switch(c) {
-    case ' ':  return HID_KEYBOARD_SPACEBAR;
-    case '\t': return HID_KEYBOARD_TAB;
-    case '-':  return HID_KEYBOARD_MINUS;
-    case '=':  return HID_KEYBOARD_EQUAL_SIGN;
-    case '[':  return HID_KEYBOARD_OPEN_BRACKET;
-    case ']':  return HID_KEYBOARD_CLOSE_BRACKET;
-    case '\\': return HID_KEYBOARD_BACKSLASH;
-    case ';':  return HID_KEYBOARD_SEMICOLON;
-    case '\'': return HID_KEYBOARD_APOSTROPHE;
-    case '`':  return HID_KEYBOARD_GRAVE_ACCENT;
+#ifdef DIAG_MEMORY
+typedef struct {
+    uint8_t* bottom; /* deepest painted byte */
+    uint32_t len;
+} DiagPaint;
+
+/* Fill unused stack below the caller with DIAG_PAINT_BYTE. Bounded by the
+ * thread's high-watermark, so it never writes past the end of the stack.
+ * Exception entry stacks onto the same stack, so results can read up to
+ * ~100 bytes high if an interrupt lands at the deepest point. */
+static DiagPaint __attribute__((noinline)) diag_stack_paint(void) {
+    DiagPaint paint = {NULL, 0};
+    uint32_t free_bytes = furi_thread_get_stack_space(furi_thread_get_current_id());
+    if(free_bytes <= DIAG_PAINT_SKIP * 2) return paint;
+
+    paint.len = free_bytes - DIAG_PAINT_SKIP * 2;
+    if(paint.len > DIAG_PAINT_MAX) paint.len = DIAG_PAINT_MAX;
+
+    volatile uint8_t here = 0;
+    uintptr_t top = (uintptr_t)&here - DIAG_PAINT_SKIP;
+    paint.bottom = (uint8_t*)(top - paint.len);
+    volatile uint8_t* p = paint.bottom;
+    for(uint32_t i = 0; i < paint.len; i++) {
+        p[i] = DIAG_PAINT_BYTE;
+    }
+    return paint;
+}
+
+static uint32_t diag_stack_used(const uint8_t* anchor, DiagPaint paint) {
+    if(!paint.bottom) return 0;
+    const volatile uint8_t* p = paint.bottom;
+    const uint8_t* end = paint.bottom + paint.len;
+    while(p < end && *p == DIAG_PAINT_BYTE) p++;
+    return (uint32_t)(anchor - (const uint8_t*)p);
+}
+
+static DiagScreen diag_screen(const RenderSnapshot* snap) {
+    switch(snap->mode) {
+    case ModeSplash:
+        return DiagScreenSplash;
+    case ModeHome:
+        return DiagScreenHome;
+    case ModeRemote:
+        return snap->stats_visible ? DiagScreenStats : DiagScreenRemote;
+    case ModeManual:
+        /* ManualView is declared in the same order */
+        return DiagScreenCategories + snap->manual_view;
+    case ModeSettings:
+        return DiagScreenSettings;
+    case ModeMacros:
+        return DiagScreenMacros;
+#ifndef HID_TRANSPORT_BLE
+    case ModeBlePromo:
+        return DiagScreenBlePromo;
+#endif
+    }
+    return DiagScreenHome;
+}
+
+static void diag_log(const ClaudeRemoteState* state) {
+    const DiagMemory* diag = &state->diag;
+    FURI_LOG_I(TAG, "diag: main stack used %lu/%lu, draw stack %lu, gui stack free %lu",
+               (unsigned long)(diag->main_stack_size - diag->main_stack_free),
+               (unsigned long)diag->main_stack_size,
+               (unsigned long)diag->draw_stack_max,
+               (unsigned long)diag->gui_stack_free);
+    FURI_LOG_I(TAG, "diag: heap app %lu, free %lu, min free %lu, screens %d/%d",
+               (unsigned long)diag->heap_app,
+               (unsigned long)diag->heap_free,
+               (unsigned long)diag->heap_min_free,
+               __builtin_popcount(diag->screens_seen), DiagScreenCount);
+}
+
+/* main thread, once per loop iteration */
+static void diag_sample(ClaudeRemoteState* state) {
+    DiagMemory* diag = &state->diag;
+    FuriThreadId self = furi_thread_get_current_id();
+    diag->main_stack_free = furi_thread_get_stack_space(self);
+    size_t heap_app = memmgr_heap_get_thread_memory(self);
+    /* firmware without heap tracing reports MEMMGR_HEAP_UNKNOWN */
+    diag->heap_app = heap_app == MEMMGR_HEAP_UNKNOWN ? 0 : heap_app;
+    diag->heap_free = memmgr_get_free_heap();
+    diag->heap_min_free = memmgr_get_minimum_free_heap();
+
+    if(!diag->reported && diag->screens_seen == (1UL << DiagScreenCount) - 1) {
+        diag->reported = true;
+        diag_log(state);
+    }
+}
+#endif
+
+/* ── Notifications ── */
+
+static const NotificationSequence* const led_sequences[] = {
+    [LedOff] = &sequence_reset_rgb,
+    [LedOrange] = &sequence_solid_orange,
+    [LedBlue] = &sequence_solid_blue,
+    [LedGreen] = &sequence_solid_green,
+};
+
+/* only talks to the notification service when the color actually changes */
+static void notify_led(ClaudeRemoteState* state, LedColor color) {
+    if(!state->led_enabled && color != LedOff) return;
+    if(state->notify.led == color) return;
+    state->notify.led = color;
+    notification_message(state->notifications, led_sequences[color]);
+}
+
+/* Queues a pulse instead of playing it from the input path; notify_flush()
+ * plays it once the keys of this loop pass are out. A burst of presses
+ * gets one pulse, the strongest one asked for. */
+static void notify_haptic(ClaudeRemoteState* state, Haptic haptic) {
+    if(!state->haptics_enabled) return;
+    if(haptic > state->notify.haptic) state->notify.haptic = haptic;
+}
+
+/* ms until a held-back pulse may play, or FuriWaitForever */
+static uint32_t notify_timeout(const ClaudeRemoteState* state) {
+    if(state->notify.haptic == HapticNone) return FuriWaitForever;
+    uint32_t since = furi_get_tick() - state->notify.haptic_tick;
+    return since >= HAPTIC_GAP_TICKS ? 0 : HAPTIC_GAP_TICKS - since;
+}
+
+static void notify_flush(ClaudeRemoteState* state) {
+    if(notify_timeout(state) != 0) return;
+    notification_message(
+        state->notifications,
+        state->notify.haptic == HapticDouble ? &sequence_double_vibro : &sequence_single_vibro);
+    state->notify.haptic = HapticNone;
+    state->notify.haptic_tick = furi_get_tick();
+}
+
+/* ── Macro set index (runs on the storage worker) ── */
+
+/* finds where each non-empty line starts, the same lines macros_parse() keeps */
+static bool macro_set_scan(File* file, const char* path, MacroSetInfo* info) {
+    bool opened = storage_file_open(file, path, FSAM_READ, FSOM_OPEN_EXISTING);
+    char chunk[64];
+    uint32_t pos = 0;
+    int32_t line_start = -1;
+    size_t n;
+    while(opened && info->count < MACRO_MAX_COUNT && pos < UINT16_MAX &&
+          (n = storage_file_read(file, chunk, sizeof(chunk))) > 0) {
+        for(size_t i = 0; i < n && info->count < MACRO_MAX_COUNT && pos < UINT16_MAX; i++, pos++) {
+            bool eol = chunk[i] == '\n' || chunk[i] == '\r';
+            if(!eol && line_start < 0) {
+                line_start = pos;
+            } else if(eol && line_start >= 0) {
+                info->offsets[info->count++] = line_start;
+                info->offsets[info->count] = pos;
+                line_start = -1;
+            }
+        }
+    }
+    if(line_start >= 0 && info->count < MACRO_MAX_COUNT) {
+        info->offsets[info->count++] = line_start;
+        info->offsets[info->count] = pos;
+    }
+    storage_file_close(file);
+    return opened;
+}
+
+static void macro_index_add(
+    Storage* storage,
+    File* file,
+    MacroIndex* index,
+    const MacroIndex* cached,
+    const char* path,
+    const char* name,
+    bool root,
+    bool* changed) {
+    FileInfo fi;
+    uint32_t mtime = 0;
+    if(index->count == MACRO_SET_MAX || storage_common_stat(storage, path, &fi) != FSE_OK) return;
+    storage_common_timestamp(storage, path, &mtime);
+
+    MacroSetInfo* info = &index->sets[index->count];
+    for(uint8_t i = 0; i < cached->count; i++) {
+        const MacroSetInfo* c = &cached->sets[i];
+        if(c->root == root && c->size == fi.size && c->mtime == mtime && strcmp(c->name, name) == 0) {
+            *info = *c;
+            index->count++;
+            return;
+        }
+    }
+
+    memset(info, 0, sizeof(MacroSetInfo));
+    snprintf(info->name, sizeof(info->name), "%s", name);
+    info->root = root;
+    info->size = fi.size;
+    info->mtime = mtime;
+    if(!macro_set_scan(file, path, info)) return;
+    index->count++;
+    *changed = true;
+}
+
+/* Lists macros.txt and macros/<name>.txt, re-scanning only files whose
+ * size or mtime differ from macros.idx, and rewrites the cache if
+ * anything changed. */
+static void macro_index_refresh(Storage* storage, File* file, MacroIndex* index) {
+    MacroIndex* cached = malloc(sizeof(MacroIndex));
+    bool cache_ok = storage_file_open(file, MACRO_INDEX_PATH, FSAM_READ, FSOM_OPEN_EXISTING) &&
+                    storage_file_read(file, cached, sizeof(MacroIndex)) == sizeof(MacroIndex) &&
+                    cached->magic == MACRO_INDEX_MAGIC && cached->version == MACRO_INDEX_VERSION &&
+                    cached->count <= MACRO_SET_MAX;
+    storage_file_close(file);
+    if(!cache_ok) cached->count = 0;
+
+    memset(index, 0, sizeof(MacroIndex));
+    index->magic = MACRO_INDEX_MAGIC;
+    index->version = MACRO_INDEX_VERSION;
+    bool changed = false;
+
+    macro_index_add(storage, file, index, cached, MACROS_PATH, "macros", true, &changed);
+
+    File* dir = storage_file_alloc(storage);
+    if(storage_dir_open(dir, MACROS_DIR)) {
+        FileInfo info;
+        char name[32];
+        while(storage_dir_read(dir, &info, name, sizeof(name))) {
+            size_t len = strlen(name);
+            if(file_info_is_dir(&info) || len < 5 || strcmp(name + len - 4, ".txt") != 0) continue;
+            if(len - 4 > MACRO_SET_NAME_LEN) continue;
+            char path[STORAGE_PATH_LEN];
+            snprintf(path, sizeof(path), "%s/%s", MACROS_DIR, name);
+            name[len - 4] = '\0';
+            macro_index_add(storage, file, index, cached, path, name, false, &changed);
+        }
+    }
+    storage_dir_close(dir);
+    storage_file_free(dir);
+
+    /* macros.txt first, then by name */
+    for(uint8_t i = 1; i < index->count; i++) {
+        MacroSetInfo set = index->sets[i];
+        uint8_t j = i;
+        while(j > 0 && !index->sets[j - 1].root && strcmp(index->sets[j - 1].name, set.name) > 0) {
+            index->sets[j] = index->sets[j - 1];
+            j--;
+        }
+        index->sets[j] = set;
+    }
+
+    if(changed || index->count != cached->count) {
+        if(storage_file_open(file, MACRO_INDEX_PATH, FSAM_WRITE, FSOM_CREATE_ALWAYS)) {
+            storage_file_write(file, index, sizeof(MacroIndex));
+        }
+        storage_file_close(file);
+    }
+    free(cached);
+}
+
+/* ── Quiz scheduling (runs on the storage worker) ── */
+
+/* Smaller comes sooner: due cards missed last time, the other due cards
+ * by box, new cards, then the rest by how many rounds they have to go. */
+static uint8_t quiz_box_rank(const QuizBox* box, uint16_t round) {
+    if(box->box == 0) return 2 * QUIZ_BOX_MAX + 1;
+    int16_t wait = (int16_t)(box->due - round);
+    if(wait <= 0) return 2 * box->box - (box->last == QuizResultWrong);
+    return wait > 200 ? 255 : 2 * QUIZ_BOX_MAX + 1 + wait;
+}
+
+/* keeps the want lowest keys; equal ranks are broken at random, drawn only
+ * for cards that can still make the round */
+static void quiz_scan_offer(QuizScan* scan, uint16_t id, const QuizBox* box) {
+    uint32_t rank = quiz_box_rank(box, scan->round);
+    bool full = scan->count == scan->want;
+    if(full && rank > scan->keys[scan->want - 1] >> 24) return;
+    uint32_t key = rank << 24 | (furi_hal_random_get() & 0xFFFFFF);
+    if(full && key >= scan->keys[scan->want - 1]) return;
+    uint8_t i = full ? scan->want - 1 : scan->count++;
+    for(; i > 0 && scan->keys[i - 1] > key; i--) {
+        scan->keys[i] = scan->keys[i - 1];
+        scan->ids[i] = scan->ids[i - 1];
+        scan->boxes[i] = scan->boxes[i - 1];
+    }
+    scan->keys[i] = key;
+    scan->ids[i] = id;
+    scan->boxes[i] = *box;
+}
+
+/* Streams the boxes file at path and picks the round: constant RAM
+ * whatever the card count. A missing file, or one kept for another card
+ * set, is written anew with every card unasked. */
+static void quiz_scan_run(Storage* storage, File* file, const char* path, QuizScan* scan) {
+    QuizBoxHeader head;
+    bool kept = storage_file_open(file, path, FSAM_READ, FSOM_OPEN_EXISTING) &&
+                storage_file_read(file, &head, sizeof(head)) == sizeof(head) &&
+                head.magic == QUIZ_BOXES_MAGIC && head.version == QUIZ_BOXES_VERSION &&
+                head.source == scan->source && head.count == scan->total;
+    QuizBox chunk[32];
+    if(!kept) {
+        storage_file_close(file);
+        head = (QuizBoxHeader){
+            .magic = QUIZ_BOXES_MAGIC,
+            .version = QUIZ_BOXES_VERSION,
+            .source = scan->source,
+            .count = scan->total};
+        memset(chunk, 0, sizeof(chunk));
+        storage_simply_mkdir(storage, APP_DATA_DIR);
+        if(storage_file_open(file, path, FSAM_WRITE, FSOM_CREATE_ALWAYS) &&
+           storage_file_write(file, &head, sizeof(head)) == sizeof(head)) {
+            for(uint32_t left = scan->total; left;) {
+                uint32_t n = left < COUNT_OF(chunk) ? left : COUNT_OF(chunk);
+                if(storage_file_write(file, chunk, n * sizeof(QuizBox)) != n * sizeof(QuizBox)) break;
+                left -= n;
+            }
+        }
+        storage_file_close(file);
+    }
+
+    scan->round = head.round;
+    scan->count = 0;
+    for(uint32_t id = 0; id < scan->total; id++) {
+        uint8_t i = id % COUNT_OF(chunk);
+        if(i == 0) {
+            memset(chunk, 0, sizeof(chunk)); /* past a short read: unasked */
+            if(kept) storage_file_read(file, chunk, sizeof(chunk));
+        }
+        quiz_scan_offer(scan, id, &chunk[i]);
+    }
+    storage_file_close(file);
+
+    /* picked soonest first; ask them in random order */
+    for(uint8_t i = scan->count; i > 1; i--) {
+        uint8_t j = furi_hal_random_get() % i;
+        uint16_t id = scan->ids[i - 1];
+        QuizBox box = scan->boxes[i - 1];
+        scan->ids[i - 1] = scan->ids[j];
+        scan->boxes[i - 1] = scan->boxes[j];
+        scan->ids[j] = id;
+        scan->boxes[j] = box;
+    }
+}
+
+/* ── Storage worker ── */
+
+/* true if the file at path holds exactly data[size] */
+static bool storage_file_matches(File* file, const char* path, const uint8_t* data, uint16_t size) {
+    uint8_t chunk[16];
+    bool same = storage_file_open(file, path, FSAM_READ, FSOM_OPEN_EXISTING);
+    for(uint16_t at = 0; same && at < size; at += sizeof(chunk)) {
+        uint16_t n = size - at < (int)sizeof(chunk) ? size - at : (int)sizeof(chunk);
+        same = storage_file_read(file, chunk, n) == n && memcmp(chunk, data + at, n) == 0;
+    }
+    same = same && storage_file_read(file, chunk, 1) == 0;
+    storage_file_close(file);
+    return same;
+}
+
+static int32_t storage_worker_thread(void* ctx) {
+    StorageWorker* io = ctx;
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(storage);
+    StorageJob job;
+
+    while(furi_message_queue_get(io->jobs, &job, FuriWaitForever) == FuriStatusOk &&
+          job.kind != StorageJobStop) {
+        if(job.kind == StorageJobRead) {
+            StorageDone done = {.tag = job.tag, .arg = job.arg, .buf = job.buf};
+            if(storage_file_open(file, job.path, FSAM_READ, FSOM_OPEN_EXISTING) &&
+               (job.offset == 0 || storage_file_seek(file, job.offset, true))) {
+                done.bytes = storage_file_read(file, job.buf, job.size);
+                done.ok = true;
+            }
+            storage_file_close(file);
+            furi_message_queue_put(io->done, &done, FuriWaitForever);
+            furi_thread_flags_set(io->consumer, APP_FLAG_STORAGE);
+        } else if(job.kind == StorageJobPatch) {
+            if(storage_file_open(file, job.path, FSAM_WRITE, FSOM_OPEN_EXISTING) &&
+               storage_file_seek(file, job.offset, true)) {
+                storage_file_write(file, job.data, job.size);
+            }
+            storage_file_close(file);
+        } else if(job.kind == StorageJobRecord) {
+            StorageDone done = {.tag = job.tag, .arg = job.arg, .buf = job.buf};
+            StorageRecord record;
+            if(storage_file_open(file, job.path, FSAM_READ, FSOM_OPEN_EXISTING) &&
+               storage_file_seek(file, job.offset, true) &&
+               storage_file_read(file, &record, sizeof(record)) == sizeof(record) &&
+               record.size <= job.size && storage_file_seek(file, record.offset, true)) {
+                done.bytes = storage_file_read(file, job.buf, record.size);
+                done.ok = done.bytes == record.size;
+            }
+            storage_file_close(file);
+            furi_message_queue_put(io->done, &done, FuriWaitForever);
+            furi_thread_flags_set(io->consumer, APP_FLAG_STORAGE);
+        } else if(job.kind == StorageJobQuizScan) {
+            quiz_scan_run(storage, file, job.path, job.buf);
+            StorageDone done = {.tag = job.tag, .arg = job.arg, .ok = true, .buf = job.buf};
+            furi_message_queue_put(io->done, &done, FuriWaitForever);
+            furi_thread_flags_set(io->consumer, APP_FLAG_STORAGE);
+        } else if(job.kind == StorageJobMacroIndex) {
+            storage_simply_mkdir(storage, APP_DATA_DIR);
+            macro_index_refresh(storage, file, job.buf);
+            StorageDone done = {.tag = job.tag, .ok = true, .buf = job.buf};
+            furi_message_queue_put(io->done, &done, FuriWaitForever);
+            furi_thread_flags_set(io->consumer, APP_FLAG_STORAGE);
+        } else if(job.kind == StorageJobRemove) {
+            storage_simply_remove(storage, job.path);
+        } else {
+            const uint8_t* data = job.buf ? job.buf : job.data;
+            storage_simply_mkdir(storage, APP_DATA_DIR);
+            bool written = storage_file_open(file, job.path, FSAM_WRITE, FSOM_CREATE_ALWAYS) &&
+                           storage_file_write(file, data, job.size) == job.size;
+            storage_file_close(file);
+            if(job.tag != StorageTagNone) {
+                StorageDone done = {.tag = job.tag, .arg = job.arg, .bytes = job.size};
+                done.ok = written && storage_file_matches(file, job.path, data, job.size);
+                furi_message_queue_put(io->done, &done, FuriWaitForever);
+                furi_thread_flags_set(io->consumer, APP_FLAG_STORAGE);
+            }
+            free(job.buf);
+        }
+    }
+
+    storage_file_free(file);
+    furi_record_close(RECORD_STORAGE);
+    return 0;
+}
+
+static void storage_worker_start(StorageWorker* io, FuriThreadId consumer) {
+    io->consumer = consumer;
+    io->jobs = furi_message_queue_alloc(STORAGE_QUEUE_LEN, sizeof(StorageJob));
+    io->done = furi_message_queue_alloc(STORAGE_QUEUE_LEN, sizeof(StorageDone));
+    io->thread = furi_thread_alloc_ex("ClaupperIO", 1536, storage_worker_thread, io);
+    furi_thread_start(io->thread);
+}
+
+/* runs whatever is still queued (settings writes), then stops */
+static void storage_worker_stop(StorageWorker* io) {
+    StorageJob job = {.kind = StorageJobStop};
+    furi_message_queue_put(io->jobs, &job, FuriWaitForever);
+    furi_thread_join(io->thread);
+    furi_thread_free(io->thread);
+
+    /* reads that finished after the main loop stopped looking */
+    StorageDone done;
+    while(furi_message_queue_get(io->done, &done, 0) == FuriStatusOk) {
+        if(done.tag == StorageTagKeymap || done.tag == StorageTagMacroIndex) free(done.buf);
+    }
+    furi_message_queue_free(io->jobs);
+    furi_message_queue_free(io->done);
+}
+
+static void storage_read(
+    StorageWorker* io,
+    StorageTag tag,
+    uint8_t arg,
+    const char* path,
+    uint32_t offset,
+    void* buf,
+    uint16_t size) {
+    StorageJob job = {
+        .kind = StorageJobRead, .tag = tag, .arg = arg, .size = size, .offset = offset, .buf = buf};
+    snprintf(job.path, sizeof(job.path), "%s", path);
+    furi_message_queue_put(io->jobs, &job, FuriWaitForever);
+}
+
+/* one record of a file that starts with a StorageRecord table: entry is
+ * the offset of its table entry. Only that entry and the record are read. */
+static void storage_read_record(
+    StorageWorker* io,
+    StorageTag tag,
+    const char* path,
+    uint32_t entry,
+    void* buf,
+    uint16_t size) {
+    StorageJob job = {
+        .kind = StorageJobRecord, .tag = tag, .size = size, .offset = entry, .buf = buf};
+    snprintf(job.path, sizeof(job.path), "%s", path);
+    furi_message_queue_put(io->jobs, &job, FuriWaitForever);
+}
+
+/* like storage_write(), for data too big to carry: buf comes from malloc
+ * and is the worker's from here on, so the caller can go on changing its own copy */
+static void storage_write_owned(StorageWorker* io, const char* path, void* buf, uint16_t size) {
+    StorageJob job = {.kind = StorageJobWrite, .size = size, .buf = buf};
+    snprintf(job.path, sizeof(job.path), "%s", path);
+    furi_message_queue_put(io->jobs, &job, FuriWaitForever);
+}
+
+static void storage_patch(
+    StorageWorker* io,
+    const char* path,
+    uint32_t offset,
+    const void* data,
+    uint16_t size) {
+    furi_check(size <= STORAGE_INLINE_MAX);
+    StorageJob job = {.kind = StorageJobPatch, .size = size, .offset = offset};
+    snprintf(job.path, sizeof(job.path), "%s", path);
+    memcpy(job.data, data, size);
+    furi_message_queue_put(io->jobs, &job, FuriWaitForever);
+}
+
+static void storage_scan_quiz(StorageWorker* io, const char* path, uint8_t arg, QuizScan* scan) {
+    StorageJob job = {.kind = StorageJobQuizScan, .tag = StorageTagQuizScan, .arg = arg, .buf = scan};
+    snprintf(job.path, sizeof(job.path), "%s", path);
+    furi_message_queue_put(io->jobs, &job, FuriWaitForever);
+}
+
+static void storage_index_macros(StorageWorker* io, MacroIndex* index) {
+    StorageJob job = {.kind = StorageJobMacroIndex, .tag = StorageTagMacroIndex, .buf = index};
+    furi_message_queue_put(io->jobs, &job, FuriWaitForever);
+}
+
+/* tag: StorageTagNone, or the completion that reports whether the file reads back intact */
+static void storage_write(
+    StorageWorker* io,
+    StorageTag tag,
+    const char* path,
+    const void* data,
+    uint16_t size) {
+    furi_check(size <= STORAGE_INLINE_MAX);
+    StorageJob job = {.kind = StorageJobWrite, .tag = tag, .size = size};
+    snprintf(job.path, sizeof(job.path), "%s", path);
+    memcpy(job.data, data, size);
+    furi_message_queue_put(io->jobs, &job, FuriWaitForever);
+}
+
+static void storage_remove(StorageWorker* io, const char* path) {
+    StorageJob job = {.kind = StorageJobRemove};
+    snprintf(job.path, sizeof(job.path), "%s", path);
+    furi_message_queue_put(io->jobs, &job, FuriWaitForever);
+}
+
+/* ── Settings persistence ── */
+
+static uint16_t clamp_hold(uint16_t ms) {
+    return ms < HOLD_MIN_MS ? HOLD_MIN_MS : ms > HOLD_MAX_MS ? HOLD_MAX_MS : ms;
+}
+
+static uint16_t clamp_tap(uint16_t ms) {
+    return ms < TAP_WINDOW_MIN_MS ? TAP_WINDOW_MIN_MS : ms > TAP_WINDOW_MAX_MS ? TAP_WINDOW_MAX_MS : ms;
+}
+
+/* settings.bin is a SettingsHeader followed by SettingsBody. New versions
+ * only append fields to the body; a shorter body from an older version is
+ * read over the defaults, so nothing has to be migrated field by field. */
+#define SETTINGS_MAGIC 0x53504C43U /* "CLPS" */
+#define SETTINGS_VERSION 1
+#define SETTINGS_IDLE_TICKS 2000 /* write-behind: flush once changes settle */
+
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t size; /* body bytes that follow */
+    uint32_t crc;  /* CRC-32 of the body */
+} SettingsHeader;
+
+typedef struct {
+    uint8_t haptics_enabled;
+    uint8_t led_enabled;
+    uint8_t os_mode;
+    uint8_t scroll_mode;
+    uint16_t hold_ms[LinkCount];
+    uint16_t tap_ms;
+    uint8_t host_slot;
+    char keymap[KEYMAP_NAME_LEN + 1]; /* "" for the built-in profile */
+    char macro_set[MACRO_SET_NAME_LEN + 1];
+    uint8_t macro_sort;
+    uint8_t manual_dense;
+} SettingsBody;
+
+_Static_assert(
+    sizeof(SettingsHeader) + sizeof(SettingsBody) <= STORAGE_INLINE_MAX,
+    "settings record must fit in one storage job");
+
+#define CRC32_INIT 0xFFFFFFFFU
+
+/* bitwise CRC-32 (IEEE); settings are a few dozen bytes, no table needed */
+static uint32_t crc32_update(uint32_t crc, const void* data, size_t len) {
+    const uint8_t* p = data;
+    while(len--) {
+        crc ^= *p++;
+        for(int bit = 0; bit < 8; bit++) crc = (crc >> 1) ^ (0xEDB88320U & -(crc & 1));
+    }
+    return crc;
+}
+
+static void settings_defaults(SettingsBody* body) {
+    memset(body, 0, sizeof(SettingsBody));
+    body->haptics_enabled = true;
+    body->led_enabled = true;
+    body->scroll_mode = ScrollModePage;
+    body->hold_ms[LinkUsb] = USB_HOLD_MS;
+    body->hold_ms[LinkBle] = BLE_HOLD_MS;
+    body->tap_ms = TAP_WINDOW_MS;
+}
+
+/* keymap_scan() has already listed the profiles the name is matched against */
+static void settings_apply(ClaudeRemoteState* state, const SettingsBody* body) {
+    state->haptics_enabled = body->haptics_enabled != 0;
+    state->led_enabled = body->led_enabled != 0;
+    state->os_mode = body->os_mode < 3 ? body->os_mode : 0;
+    state->scroll_mode = body->scroll_mode == ScrollModeWheel ? ScrollModeWheel : ScrollModePage;
+    state->hold_ms[LinkUsb] = clamp_hold(body->hold_ms[LinkUsb]);
+    state->hold_ms[LinkBle] = clamp_hold(body->hold_ms[LinkBle]);
+    state->gesture.tap_ms = clamp_tap(body->tap_ms);
+#ifdef HID_TRANSPORT_BLE
+    if(body->host_slot < HOST_SLOT_COUNT) state->host_slot = body->host_slot;
+#endif
+    memcpy(state->macro_set_name, body->macro_set, MACRO_SET_NAME_LEN);
+    state->macro_sort = body->macro_sort == MacroSortFile ? MacroSortFile : MacroSortUsage;
+    state->manual_dense = body->manual_dense != 0;
+    state->keymap_index = 0;
+    for(uint8_t i = 1; i < state->keymap_count; i++) {
+        if(strncmp(state->keymap_names[i], body->keymap, KEYMAP_NAME_LEN) == 0) state->keymap_index = i;
+    }
+}
+
+static void settings_pack(const ClaudeRemoteState* state, SettingsBody* body) {
+    settings_defaults(body);
+    body->haptics_enabled = state->haptics_enabled;
+    body->led_enabled = state->led_enabled;
+    body->os_mode = state->os_mode;
+    body->scroll_mode = state->scroll_mode;
+    body->hold_ms[LinkUsb] = state->hold_ms[LinkUsb];
+    body->hold_ms[LinkBle] = state->hold_ms[LinkBle];
+    body->tap_ms = state->gesture.tap_ms;
+#ifdef HID_TRANSPORT_BLE
+    body->host_slot = state->host_slot;
+#endif
+    if(state->keymap_index > 0) {
+        memcpy(body->keymap, state->keymap_names[state->keymap_index], KEYMAP_NAME_LEN + 1);
+    }
+    memcpy(body->macro_set, state->macro_set_name, MACRO_SET_NAME_LEN + 1);
+    body->macro_sort = state->macro_sort;
+    body->manual_dense = state->manual_dense;
+}
+
+/* the old key=value settings.cfg, read once into body; false if there is none */
+static bool settings_read_text(File* file, SettingsBody* body) {
+    char buf[128];
+    uint16_t bytes_read = 0;
+    bool found = storage_file_open(file, SETTINGS_TEXT_PATH, FSAM_READ, FSOM_OPEN_EXISTING);
+    if(found) bytes_read = storage_file_read(file, buf, sizeof(buf) - 1);
+    buf[bytes_read] = '\0';
+    storage_file_close(file);
+    if(!found) return false;
+
+    char* p = buf;
+    while(*p) {
+        if(strncmp(p, "haptics=", 8) == 0) {
+            body->haptics_enabled = (p[8] == '1');
+        } else if(strncmp(p, "led=", 4) == 0) {
+            body->led_enabled = (p[4] == '1');
+        } else if(strncmp(p, "os=", 3) == 0) {
+            body->os_mode = p[3] == 'w' ? 1 : p[3] == 'l' ? 2 : 0;
+        } else if(strncmp(p, "scroll=", 7) == 0) {
+            body->scroll_mode = p[7] == 'w' ? ScrollModeWheel : ScrollModePage;
+        } else if(strncmp(p, "hold_usb=", 9) == 0) {
+            body->hold_ms[LinkUsb] = parse_u16(p + 9);
+        } else if(strncmp(p, "hold_ble=", 9) == 0) {
+            body->hold_ms[LinkBle] = parse_u16(p + 9);
+        } else if(strncmp(p, "keymap=", 7) == 0) {
+            size_t len = strcspn(p + 7, "\r\n");
+            if(len <= KEYMAP_NAME_LEN) memcpy(body->keymap, p + 7, len);
+        } else if(strncmp(p, "tap_ms=", 7) == 0) {
+            body->tap_ms = parse_u16(p + 7);
+        } else if(strncmp(p, "host=", 5) == 0) {
+            if(p[5] >= '1' && p[5] < '1' + HOST_SLOT_COUNT) body->host_slot = p[5] - '1';
+        }
+        while(*p && *p != '\n') p++;
+        if(*p == '\n') p++;
+    }
+    return true;
+}
+
+static void settings_flush(ClaudeRemoteState* state) {
+    if(!state->settings_dirty) return;
+    state->settings_dirty = false;
+
+    struct {
+        SettingsHeader header;
+        SettingsBody body;
+    } record;
+    settings_pack(state, &record.body);
+    record.header.magic = SETTINGS_MAGIC;
+    record.header.version = SETTINGS_VERSION;
+    record.header.size = sizeof(SettingsBody);
+    record.header.crc = ~crc32_update(CRC32_INIT, &record.body, sizeof(SettingsBody));
+    /* while settings.cfg is still around, have the write checked before it goes */
+    storage_write(
+        &state->io, state->settings_migrating ? StorageTagSettings : StorageTagNone,
+        SETTINGS_PATH, &record, sizeof(record));
+}
+
+/* settings.bin from a migration is on the card and reads back intact */
+static void settings_written(ClaudeRemoteState* state, const StorageDone* done) {
+    if(!state->settings_migrating) return;
+    if(!done->ok) {
+        FURI_LOG_W(TAG, "settings.bin did not verify, keeping settings.cfg");
+        return; /* the next flush tries again */
+    }
+    state->settings_migrating = false;
+    storage_remove(&state->io, SETTINGS_TEXT_PATH);
+    FURI_LOG_I(TAG, "settings.cfg migrated to settings.bin");
+}
+
+/* marks settings for the write-behind flush in the main loop; toggling
+ * several settings in a row costs one SD write */
+static void settings_changed(ClaudeRemoteState* state) {
+    state->settings_dirty = true;
+    state->settings_tick = furi_get_tick();
+}
+
+static void load_settings(ClaudeRemoteState* state) {
+    SettingsBody body;
+    settings_defaults(&body);
+    bool migrate = false;
+
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(storage);
+
+    if(storage_file_open(file, SETTINGS_PATH, FSAM_READ, FSOM_OPEN_EXISTING)) {
+        SettingsHeader header;
+        SettingsBody stored = body;
+        bool valid = storage_file_read(file, &header, sizeof(header)) == sizeof(header) &&
+                     header.magic == SETTINGS_MAGIC;
+        if(valid) {
+            /* an older, shorter body leaves the newer fields at their defaults;
+             * a newer, longer one only has its tail checked against the CRC */
+            size_t size = header.size < sizeof(stored) ? header.size : sizeof(stored);
+            valid = storage_file_read(file, &stored, size) == size;
+            uint32_t crc = crc32_update(CRC32_INIT, &stored, size);
+            uint8_t tail[16];
+            for(size_t left = header.size - size; valid && left > 0;) {
+                size_t chunk = left < sizeof(tail) ? left : sizeof(tail);
+                valid = storage_file_read(file, tail, chunk) == chunk;
+                crc = crc32_update(crc, tail, chunk);
+                left -= chunk;
+            }
+            valid = valid && ~crc == header.crc;
+        }
+        storage_file_close(file);
+        if(valid) {
+            body = stored;
+        } else {
+            FURI_LOG_W(TAG, "settings.bin unreadable, using defaults");
+        }
+    } else {
+        storage_file_close(file);
+        /* removed by settings_written() once settings.bin is known good */
+        migrate = settings_read_text(file, &body);
+    }
+
+    storage_file_free(file);
+    furi_record_close(RECORD_STORAGE);
+
+    settings_apply(state, &body);
+    if(migrate) {
+        state->settings_migrating = true;
+        state->settings_dirty = true;
+        settings_flush(state);
+    }
+}
+
+
+/* ── Macro helpers ── */
+
+static uint16_t char_to_hid(char c) {
+    if(c >= 'a' && c <= 'z') return HID_KEYBOARD_A + (c - 'a');
+    if(c >= 'A' && c <= 'Z') return (HID_KEYBOARD_A + (c - 'A')) | KEY_MOD_LEFT_SHIFT;
+    if(c >= '1' && c <= '9') return HID_KEYBOARD_1 + (c - '1');
+    if(c == '0') return HID_KEYBOARD_0;
+    switch(c) {
+    case ' ':  return HID_KEYBOARD_SPACEBAR;
+    case '\t': return HID_KEYBOARD_TAB;
+    case '-':  return HID_KEYBOARD_MINUS;
+    case '=':  return HID_KEYBOARD_EQUAL_SIGN;
+    case '[':  return HID_KEYBOARD_OPEN_BRACKET;
+    case ']':  return HID_KEYBOARD_CLOSE_BRACKET;
+    case '\\': return HID_KEYBOARD_BACKSLASH;
+    case ';':  return HID_KEYBOARD_SEMICOLON;
+    case '\'': return HID_KEYBOARD_APOSTROPHE;
+    case '`':  return HID_KEYBOARD_GRAVE_ACCENT;
     case ',':  return HID_KEYBOARD_COMMA;
     case '.':  return HID_KEYBOARD_DOT;
     case '/':  return HID_KEYBOARD_SLASH;
@@ -878,46 +2046,371 @@ static uint16_t char_to_hid(char c) {
     }
 }
 
-/* ── BLE status callback ── */
+/* ── Link state callbacks ── */
+
+/* Runs on the USB/BT service threads: record the transition and wake the
+ * main loop. Repeated reports of the same state are ignored. */
+static void link_post(LinkState* link, LinkId id, bool up) {
+    if(atomic_exchange(&link->up[id], up) == up) return;
+    atomic_store(&link->changed_tick[id], furi_get_tick());
+    furi_thread_flags_set(link->consumer, APP_FLAG_LINK);
+}
+
+#ifndef HID_TRANSPORT_MOCK
+static void usb_state_callback(bool connected, void* context) {
+    link_post((LinkState*)context, LinkUsb, connected);
+}
+#endif
 
 #ifdef HID_TRANSPORT_BLE
 static void bt_status_callback(BtStatus status, void* context) {
-    ClaudeRemoteState* state = (ClaudeRemoteState*)context;
-    state->ble_connected = (status == BtStatusConnected);
-    if(state->use_ble) {
-        state->hid_connected = state->ble_connected;
+    link_post((LinkState*)context, LinkBle, status == BtStatusConnected);
+    FURI_LOG_I(TAG, "BT status: %d", status);
+}
+#endif
+
+/* Main loop side: pick up the active link's state. */
+static void link_refresh(ClaudeRemoteState* state) {
+#ifdef HID_TRANSPORT_BLE
+    uint8_t selected = state->output;
+#else
+    uint8_t selected = 1U << LinkUsb;
+#endif
+    bool any_up = false;
+    uint32_t since = 0;
+    for(int i = 0; i < LinkCount; i++) {
+        bool up = atomic_load(&state->link.up[i]);
+        if(up != state->link_up[i]) {
+            FURI_LOG_I(TAG, "%s %s", i == LinkBle ? "BT" : "USB", up ? "connected" : "disconnected");
+            state->link_up[i] = up;
+#ifdef HID_TRANSPORT_BLE
+            if(i == LinkBle && up && state->host_switching) {
+                state->host_switching = false;
+                state->host_ready_tick = furi_get_tick();
+                state->host_ready_ms = state->host_ready_tick - state->host_switch_tick;
+                FURI_LOG_I(TAG, "host %s ready in %lums", state->host_names[state->host_slot],
+                           (unsigned long)state->host_ready_ms);
+            }
+#endif
+        }
+        if(!(selected & (1U << i))) continue;
+        any_up |= up;
+        uint32_t tick = atomic_load(&state->link.changed_tick[i]);
+        if(since == 0 || (int32_t)(tick - since) > 0) since = tick;
+    }
+    state->hid_connected = any_up;
+    state->link_since = since;
+}
+
+/* ── HID transports ── */
+
+#define HID_CONSUMER_DICTATION 0x00CF /* Consumer Page: Voice Command (triggers Edit > Start Dictation on macOS) */
+
+/* Hot-path operations of one HID link. Setup/teardown lives in
+ * hid_*_start()/hid_*_stop() since it never runs per key; connection
+ * state arrives through the link state callbacks, not through polling. */
+typedef struct HidTransport {
+    const char* name;
+    bool (*press)(void* ctx, uint16_t keycode);
+    bool (*release)(void* ctx, uint16_t keycode);
+    bool (*consumer_press)(void* ctx, uint16_t usage);
+    bool (*consumer_release)(void* ctx, uint16_t usage);
+    bool (*release_all)(void* ctx);
+    bool (*mouse_scroll)(void* ctx, int8_t delta); /* wheel ticks, positive scrolls up */
+    uint8_t (*led_state)(void* ctx); /* HID_KB_LED_* bits from the host's last output report;
+                                      * NULL where the firmware doesn't expose them */
+} HidTransport;
+
+#if defined(HID_TRANSPORT_MOCK) && defined(HID_TRANSPORT_BLE)
+#error "HID_TRANSPORT_MOCK replaces the USB link; use it with HID_TRANSPORT_USB"
+#endif
+
+#ifndef HID_TRANSPORT_MOCK
+static bool usb_press(void* ctx, uint16_t keycode) {
+    UNUSED(ctx);
+    return furi_hal_hid_kb_press(keycode);
+}
+static bool usb_release(void* ctx, uint16_t keycode) {
+    UNUSED(ctx);
+    return furi_hal_hid_kb_release(keycode);
+}
+static bool usb_consumer_press(void* ctx, uint16_t usage) {
+    UNUSED(ctx);
+    return furi_hal_hid_consumer_key_press(usage);
+}
+static bool usb_consumer_release(void* ctx, uint16_t usage) {
+    UNUSED(ctx);
+    return furi_hal_hid_consumer_key_release(usage);
+}
+static bool usb_release_all(void* ctx) {
+    UNUSED(ctx);
+    furi_hal_hid_consumer_key_release_all();
+    return furi_hal_hid_kb_release_all();
+}
+static bool usb_mouse_scroll(void* ctx, int8_t delta) {
+    UNUSED(ctx);
+    return furi_hal_hid_mouse_scroll(delta);
+}
+static uint8_t usb_led_state(void* ctx) {
+    UNUSED(ctx);
+    return furi_hal_hid_get_led_state();
+}
+#endif
+
+#ifdef HID_TRANSPORT_MOCK
+/* Logs instead of sending and leaves USB in CDC mode, so the log is
+ * readable over the CLI while driving the UI. Lock keys toggle a fake
+ * LED byte so the RTT probe has something to measure. */
+static uint8_t mock_leds;
+static bool mock_press(void* ctx, uint16_t keycode) {
+    UNUSED(ctx);
+    FURI_LOG_I(TAG, "mock press 0x%04X", keycode);
+    if(keycode == HID_KEYBOARD_CAPS_LOCK) mock_leds ^= HID_KB_LED_CAPS;
+    if(keycode == HID_KEYPAD_NUMLOCK) mock_leds ^= HID_KB_LED_NUM;
+    return true;
+}
+static bool mock_release(void* ctx, uint16_t keycode) {
+    UNUSED(ctx);
+    FURI_LOG_D(TAG, "mock release 0x%04X", keycode);
+    return true;
+}
+static bool mock_consumer_press(void* ctx, uint16_t usage) {
+    UNUSED(ctx);
+    FURI_LOG_I(TAG, "mock consumer 0x%04X", usage);
+    return true;
+}
+static bool mock_consumer_release(void* ctx, uint16_t usage) {
+    UNUSED(ctx);
+    UNUSED(usage);
+    return true;
+}
+static bool mock_release_all(void* ctx) {
+    UNUSED(ctx);
+    return true;
+}
+static bool mock_mouse_scroll(void* ctx, int8_t delta) {
+    UNUSED(ctx);
+    FURI_LOG_I(TAG, "mock wheel %d", delta);
+    return true;
+}
+static uint8_t mock_led_state(void* ctx) {
+    UNUSED(ctx);
+    return mock_leds;
+}
+#endif
+
+#ifdef HID_TRANSPORT_BLE
+static bool ble_press(void* ctx, uint16_t keycode) {
+    return ble_profile_hid_kb_press((FuriHalBleProfileBase*)ctx, keycode);
+}
+static bool ble_release(void* ctx, uint16_t keycode) {
+    return ble_profile_hid_kb_release((FuriHalBleProfileBase*)ctx, keycode);
+}
+static bool ble_consumer_press(void* ctx, uint16_t usage) {
+    return ble_profile_hid_consumer_key_press((FuriHalBleProfileBase*)ctx, usage);
+}
+static bool ble_consumer_release(void* ctx, uint16_t usage) {
+    return ble_profile_hid_consumer_key_release((FuriHalBleProfileBase*)ctx, usage);
+}
+static bool ble_release_all(void* ctx) {
+    ble_profile_hid_consumer_key_release_all((FuriHalBleProfileBase*)ctx);
+    return ble_profile_hid_kb_release_all((FuriHalBleProfileBase*)ctx);
+}
+static bool ble_mouse_scroll(void* ctx, int8_t delta) {
+    return ble_profile_hid_mouse_scroll((FuriHalBleProfileBase*)ctx, delta);
+}
+
+static const HidTransport hid_transport_usb = {
+    .name = "USB",
+    .press = usb_press,
+    .release = usb_release,
+    .consumer_press = usb_consumer_press,
+    .consumer_release = usb_consumer_release,
+    .release_all = usb_release_all,
+    .mouse_scroll = usb_mouse_scroll,
+    .led_state = usb_led_state,
+};
+
+static const HidTransport hid_transport_ble = {
+    .name = "BT",
+    .press = ble_press,
+    .release = ble_release,
+    .consumer_press = ble_consumer_press,
+    .consumer_release = ble_consumer_release,
+    .release_all = ble_release_all,
+    .mouse_scroll = ble_mouse_scroll,
+    .led_state = NULL, /* the BLE HID profile keeps the host's LED report to itself */
+};
+
+/* indexed by LinkId; the links a key goes to are chosen at runtime on the
+ * Home screen, so this build pays one indirect call per report per link */
+static const HidTransport* const hid_transports[LinkCount] = {
+    [LinkUsb] = &hid_transport_usb,
+    [LinkBle] = &hid_transport_ble,
+};
+#define HID_LINK_CALL(state, link, op, ...) \
+    (hid_transports[link]->op((state)->transport_ctx[link], ##__VA_ARGS__))
+#elif defined(HID_TRANSPORT_MOCK)
+#define HID_CALL(state, op, ...) ((void)(state), mock_##op(NULL, ##__VA_ARGS__))
+#else
+/* USB-only build: every call resolves at compile time */
+#define HID_CALL(state, op, ...) ((void)(state), usb_##op(NULL, ##__VA_ARGS__))
+#endif
+#ifndef HID_TRANSPORT_BLE
+/* one link only: lets per-link code (the RTT probe) build everywhere */
+#define HID_LINK_CALL(state, link, op, ...) ((void)(link), HID_CALL(state, op, ##__VA_ARGS__))
+#endif
+
+/* ── Transport setup / teardown ── */
+
+static void hid_usb_start(ClaudeRemoteState* state) {
+    if(state->usb_started) return;
+#ifdef HID_TRANSPORT_MOCK
+    link_post(&state->link, LinkUsb, true); /* the mock host is always attached */
+#else
+    state->usb_prev = furi_hal_usb_get_config();
+    furi_hal_usb_unlock();
+    furi_hal_usb_set_config(&usb_hid, NULL);
+    /* reports the current state right away if the host is already attached */
+    furi_hal_hid_set_state_callback(usb_state_callback, &state->link);
+#endif
+    state->usb_started = true;
+}
+
+static void hid_usb_stop(ClaudeRemoteState* state) {
+    if(!state->usb_started) return;
+#ifdef HID_TRANSPORT_MOCK
+    mock_release_all(NULL);
+#else
+    furi_hal_hid_set_state_callback(NULL, NULL);
+    usb_release_all(NULL);
+    furi_hal_usb_set_config(state->usb_prev, NULL);
+#endif
+    link_post(&state->link, LinkUsb, false);
+    state->usb_started = false;
+}
+
+#ifdef HID_TRANSPORT_BLE
+/* Slot 1 is the firmware's own bond, so hosts paired before slots existed
+ * keep working. The others each get a keys file and a MAC/name of their
+ * own: every host bonds to a different "device" and reconnects to it by
+ * itself once that identity starts advertising again. */
+static const char* const host_keys_path[HOST_SLOT_COUNT] = {
+    NULL,
+    APP_DATA_PATH(".host2.keys"),
+    APP_DATA_PATH(".host3.keys"),
+    APP_DATA_PATH(".host4.keys"),
+};
+
+static const BleProfileHidParams host_params[HOST_SLOT_COUNT] = {
+    {0},
+    {.device_name_prefix = "Claup2", .mac_xor = 0x0002},
+    {.device_name_prefix = "Claup3", .mac_xor = 0x0003},
+    {.device_name_prefix = "Claup4", .mac_xor = 0x0004},
+};
+
+/* one name per line in hosts.txt; the line count is the number of slots */
+static void load_hosts(ClaudeRemoteState* state) {
+    state->host_count = 0;
+
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(storage);
+
+    if(storage_file_open(file, HOSTS_PATH, FSAM_READ, FSOM_OPEN_EXISTING)) {
+        char buf[HOST_SLOT_COUNT * 24];
+        uint16_t bytes_read = storage_file_read(file, buf, sizeof(buf) - 1);
+        buf[bytes_read] = '\0';
+
+        char* p = buf;
+        while(*p && state->host_count < HOST_SLOT_COUNT) {
+            char* line_start = p;
+            while(*p && *p != '\n' && *p != '\r') p++;
+
+            int len = p - line_start;
+            if(len > HOST_NAME_LEN) len = HOST_NAME_LEN;
+
+            if(len > 0) {
+                memcpy(state->host_names[state->host_count], line_start, len);
+                state->host_names[state->host_count][len] = '\0';
+                state->host_count++;
+            }
+
+            while(*p == '\n' || *p == '\r') p++;
+        }
+    }
+
+    storage_file_close(file);
+    storage_file_free(file);
+    furi_record_close(RECORD_STORAGE);
+
+    /* no file: two unnamed slots, enough for a desktop + laptop */
+    if(state->host_count == 0) state->host_count = 2;
+    for(uint8_t i = 0; i < state->host_count; i++) {
+        if(state->host_names[i][0] == '\0') {
+            snprintf(state->host_names[i], sizeof(state->host_names[i]), "Host %d", i + 1);
+        }
+    }
+    if(state->host_slot >= state->host_count) state->host_slot = 0;
+}
+
+/* call with the radio disconnected */
+static void hid_ble_profile_start(ClaudeRemoteState* state) {
+    uint8_t slot = state->host_slot;
+    if(host_keys_path[slot]) {
+        bt_keys_storage_set_storage_path(state->bt, host_keys_path[slot]);
+    } else {
+        bt_keys_storage_set_default_path(state->bt);
+    }
+    state->ble_profile = bt_profile_start(
+        state->bt, ble_profile_hid, slot ? (FuriHalBleProfileParams)&host_params[slot] : NULL);
+    state->transport_ctx[LinkBle] = state->ble_profile;
+}
+
+static void hid_ble_start(ClaudeRemoteState* state) {
+    load_hosts(state);
+    state->bt = furi_record_open(RECORD_BT);
+    bt_disconnect(state->bt);
+    furi_delay_ms(200);
+    hid_ble_profile_start(state);
+    bt_set_status_changed_callback(state->bt, bt_status_callback, &state->link);
+    link_post(&state->link, LinkBle, ble_profile_hid_is_connected(state->ble_profile));
+}
+
+static void hid_ble_stop(ClaudeRemoteState* state) {
+    bt_set_status_changed_callback(state->bt, NULL, NULL);
+    ble_release_all(state->ble_profile);
+    if(host_keys_path[state->host_slot]) {
+        /* hand the firmware back its own bond before its profile restarts */
+        bt_disconnect(state->bt);
+        furi_delay_ms(200);
+        bt_keys_storage_set_default_path(state->bt);
     }
-    FURI_LOG_I(TAG, "BT status: %d, connected: %d", status, state->ble_connected);
+    bt_profile_restore_default(state->bt);
+    furi_record_close(RECORD_BT);
 }
-#endif
-
-/* ── HID helpers ── */
 
-#define HID_CONSUMER_DICTATION 0x00CF /* Consumer Page: Voice Command (triggers Edit > Start Dictation on macOS) */
-
-#ifdef HID_TRANSPORT_BLE
-static void send_hid_key_ble(FuriHalBleProfileBase* profile, uint16_t keycode) {
-    ble_profile_hid_kb_press(profile, keycode);
-    furi_delay_ms(150);
-    ble_profile_hid_kb_release(profile, keycode);
-}
-static void send_consumer_key_ble(FuriHalBleProfileBase* profile, uint16_t usage) {
-    ble_profile_hid_consumer_key_press(profile, usage);
-    furi_delay_ms(150);
-    ble_profile_hid_consumer_key_release(profile, usage);
+/* Drop the current host and advertise as the next slot's identity. The
+ * host bonded to that identity reconnects on its own; time-to-ready is
+ * measured until the BT link comes back up (see link_refresh()). */
+static void hid_host_switch(ClaudeRemoteState* state, uint8_t slot) {
+    ble_release_all(state->ble_profile);
+    bt_disconnect(state->bt);
+    furi_delay_ms(200);
+    state->host_slot = slot;
+    state->host_switching = true;
+    state->host_switch_tick = furi_get_tick();
+    hid_ble_profile_start(state);
+    settings_changed(state);
+    FURI_LOG_I(TAG, "switching to host %s", state->host_names[slot]);
 }
-#endif
 
-static void send_hid_key_usb(uint16_t keycode) {
-    furi_hal_hid_kb_press(keycode);
-    furi_delay_ms(50);
-    furi_hal_hid_kb_release(keycode);
-}
-static void send_consumer_key_usb(uint16_t usage) {
-    furi_hal_hid_consumer_key_press(usage);
-    furi_delay_ms(50);
-    furi_hal_hid_consumer_key_release(usage);
+static void hid_select(ClaudeRemoteState* state, HidOutput output) {
+    /* USB HID only takes over the port once USB is actually picked */
+    if(output & HidOutputUsb) hid_usb_start(state);
+    state->output = output;
+    link_refresh(state);
 }
+#endif
 
 /* ── WETWARE logo bitmap (128x20, XBM format) ── */
 
@@ -949,21 +2442,268 @@ static const uint8_t wetware_logo[] = {
 
 /* ── Transport-agnostic key send ── */
 
+/* press, hold, release on the selected link(s); timed for the stats page */
+static void hid_send(ClaudeRemoteState* state, uint16_t code, bool consumer) {
+    uint32_t start = furi_get_tick();
+#ifdef HID_TRANSPORT_BLE
+    /* press on every selected link that is up, hold once for the slowest of
+     * them, then release the same set — both hosts see the key together */
+    uint8_t sent = 0;
+    uint16_t hold_ms = 0;
+    {
+        PROF_SCOPE(ProfRegionHidPress);
+        for(int i = 0; i < LinkCount; i++) {
+            if(!(state->output & (1U << i)) || !state->link_up[i]) continue;
+            if(consumer) HID_LINK_CALL(state, i, consumer_press, code);
+            else HID_LINK_CALL(state, i, press, code);
+            if(state->hold_ms[i] > hold_ms) hold_ms = state->hold_ms[i];
+            sent |= 1U << i;
+        }
+    }
+    furi_delay_ms(hold_ms);
+    {
+        PROF_SCOPE(ProfRegionHidRelease);
+        for(int i = 0; i < LinkCount; i++) {
+            if(!(sent & (1U << i))) continue;
+            if(consumer) HID_LINK_CALL(state, i, consumer_release, code);
+            else HID_LINK_CALL(state, i, release, code);
+        }
+    }
+    state->stats.reports += 2 * __builtin_popcount(sent);
+#else
+    {
+        PROF_SCOPE(ProfRegionHidPress);
+        if(consumer) HID_CALL(state, consumer_press, code);
+        else HID_CALL(state, press, code);
+    }
+    furi_delay_ms(state->hold_ms[LinkUsb]);
+    {
+        PROF_SCOPE(ProfRegionHidRelease);
+        if(consumer) HID_CALL(state, consumer_release, code);
+        else HID_CALL(state, release, code);
+    }
+    state->stats.reports += 2;
+#endif
+    stats_hist_add(&state->stats.send_time, furi_get_tick() - start);
+}
+
+#define SEND_HID(state, k) hid_send((state), (k), false)
+#define SEND_CONSUMER(state, k) hid_send((state), (k), true)
+
+/* ── Host round-trip probe ── */
+
+#define RTT_PROBES 8         /* toggle + toggle back per probe, so the lock state is restored */
+#define RTT_TIMEOUT_MS 300
+#define RTT_GAP_MS 20        /* after each release, so the host sees it before the next press */
+#define RTT_MARGIN_MS 5
+#define RTT_MIN_SAMPLES 4
+
+static bool link_selected(const ClaudeRemoteState* state, int link) {
 #ifdef HID_TRANSPORT_BLE
-#define SEND_HID(state, k) do { \
-    if((state)->use_ble) send_hid_key_ble((state)->ble_profile, (k)); \
-    else send_hid_key_usb((k)); \
-} while(0)
-#define SEND_CONSUMER(state, k) do { \
-    if((state)->use_ble) send_consumer_key_ble((state)->ble_profile, (k)); \
-    else send_consumer_key_usb((k)); \
-} while(0)
+    return state->output & (1U << link);
 #else
-#define SEND_HID(state, k) do { (void)(state); send_hid_key_usb((k)); } while(0)
-#define SEND_CONSUMER(state, k) do { (void)(state); send_consumer_key_usb((k)); } while(0)
+    UNUSED(state);
+    return link == LinkUsb;
 #endif
+}
+
+/* USB is the only transport that hands back the host's LED report (the BLE
+ * profile keeps it to itself), so it is the only link the probe times. */
+#define RTT_LINK LinkUsb
+
+static bool rtt_link_ok(const ClaudeRemoteState* state) {
+    return link_selected(state, RTT_LINK) && state->link_up[RTT_LINK];
+}
+
+/* Caps Lock is the only lock LED macOS reports; elsewhere Num Lock is the
+ * least disruptive key to flip. */
+static uint16_t rtt_key(const ClaudeRemoteState* state) {
+    return state->os_mode == 0 ? HID_KEYBOARD_CAPS_LOCK : HID_KEYPAD_NUMLOCK;
+}
+
+static uint8_t rtt_led(const ClaudeRemoteState* state) {
+    return state->os_mode == 0 ? HID_KB_LED_CAPS : HID_KB_LED_NUM;
+}
+
+static void rtt_press(ClaudeRemoteState* state, RttPhase phase) {
+    RttProbe* probe = &state->rtt;
+    probe->before = HID_LINK_CALL(state, RTT_LINK, led_state);
+    HID_LINK_CALL(state, RTT_LINK, press, rtt_key(state));
+    probe->presses++;
+    state->stats.reports++;
+    probe->phase = phase;
+    probe->tick = furi_get_tick();
+}
+
+static void rtt_end(ClaudeRemoteState* state) {
+    RttProbe* probe = &state->rtt;
+    const LatencyHist* hist = &state->stats.rtt;
+    FURI_LOG_I(TAG, "rtt USB: avg %lums max %lums, %d/%d no LED report%s",
+               (unsigned long)stats_hist_avg(hist), (unsigned long)hist->max_ms,
+               probe->lost, probe->toggles, probe->abort ? ", stopped" : "");
+    probe->phase = RttIdle;
+}
+
+/* OK on the RTT page: RTT_PROBES round trips on the USB link. The main
+ * loop steps it through rtt_tick(). */
+static void rtt_run(ClaudeRemoteState* state) {
+    RttProbe* probe = &state->rtt;
+    if(probe->phase != RttIdle) return;
+    if(!rtt_link_ok(state)) {
+        state->flash_label = "No USB link";
+        state->flash_tick = furi_get_tick();
+        return;
+    }
+    probe->abort = false;
+    probe->toggles = 0;
+    probe->lost = 0;
+    probe->presses = 0;
+    probe->restored = false;
+    probe->origin = HID_LINK_CALL(state, RTT_LINK, led_state);
+    rtt_press(state, RttHeld);
+}
+
+/* Back on the RTT page: the key down now is released and the LED put back */
+static void rtt_stop(ClaudeRemoteState* state) {
+    state->rtt.abort = true;
+}
+
+/* how long the main loop may sleep before rtt_tick() has work */
+static uint32_t rtt_timeout(const ClaudeRemoteState* state) {
+    const RttProbe* probe = &state->rtt;
+    if(probe->phase == RttIdle) return UINT32_MAX;
+    if(probe->phase != RttGap) return 1; /* polling the LED report */
+    uint32_t gone = furi_get_tick() - probe->tick;
+    return gone >= RTT_GAP_MS ? 0 : RTT_GAP_MS - gone;
+}
+
+/* Each toggle holds the lock key down until the host's LED output report
+ * reflects it: the host has provably processed the press by then, which is
+ * what the press -> release hold has to cover. After every pair, and when
+ * stopped, the LED is checked against where it started and toggled back if
+ * a report was lost along the way. */
+static void rtt_tick(ClaudeRemoteState* state) {
+    RttProbe* probe = &state->rtt;
+    uint32_t gone = furi_get_tick() - probe->tick;
+    uint8_t led = rtt_led(state);
+
+    switch(probe->phase) {
+    case RttHeld:
+    case RttRestore: {
+        bool seen = (HID_LINK_CALL(state, RTT_LINK, led_state) ^ probe->before) & led;
+        /* Back cuts a timed toggle short, but a restore still waits for its report */
+        bool cut = probe->abort && probe->phase == RttHeld;
+        if(!seen && gone < RTT_TIMEOUT_MS && !cut) return;
+        HID_LINK_CALL(state, RTT_LINK, release, rtt_key(state));
+        state->stats.reports++;
+        probe->seen = seen;
+        if(probe->phase == RttHeld) {
+            probe->toggles++;
+            if(seen) {
+                stats_hist_add(&state->stats.rtt, gone);
+            } else if(!cut) {
+                probe->lost++;
+            }
+        }
+        probe->phase = RttGap;
+        probe->tick = furi_get_tick();
+        break;
+    }
+    case RttGap: {
+        if(gone < RTT_GAP_MS) return;
+        bool up = state->link_up[RTT_LINK];
+        bool sample_done = probe->toggles % 2 == 0 || probe->abort || !up;
+        /* with the last report in, the LED says where the lock is; without
+         * it, an odd number of presses means it's still flipped */
+        bool flipped = probe->seen ?
+                           (HID_LINK_CALL(state, RTT_LINK, led_state) ^ probe->origin) & led :
+                           probe->presses % 2;
+        if(sample_done && !probe->restored && up && flipped) {
+            probe->restored = true;
+            rtt_press(state, RttRestore);
+            break;
+        }
+        probe->restored = false;
+        if(probe->abort || !up || probe->toggles >= RTT_PROBES * 2) {
+            rtt_end(state);
+        } else {
+            rtt_press(state, RttHeld);
+        }
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+/* The slowest round trip seen, plus a margin: 0 until there are enough samples */
+static uint16_t rtt_suggest_hold(const LatencyHist* hist) {
+    if(hist->count < RTT_MIN_SAMPLES) return 0;
+    return clamp_hold(hist->max_ms + RTT_MARGIN_MS);
+}
+
+static void rtt_apply(ClaudeRemoteState* state) {
+    uint16_t hold = rtt_suggest_hold(&state->stats.rtt);
+    if(hold) state->hold_ms[RTT_LINK] = hold;
+    settings_changed(state);
+}
+
+/* at exit: stop a running probe and step it to the end here, so the host
+ * isn't left with the lock key down or its lock flipped */
+static void rtt_finish(ClaudeRemoteState* state) {
+    if(state->rtt.phase == RttIdle) return;
+    rtt_stop(state);
+    while(state->rtt.phase != RttIdle) {
+        uint32_t wait = rtt_timeout(state);
+        if(wait) furi_delay_ms(wait);
+        rtt_tick(state);
+    }
+}
+
+/* ── Hold-to-scroll ── */
+
+/* steps per button repeat (~150ms apart), indexed by repeats so far */
+static const uint8_t scroll_accel[] = {1, 1, 1, 2, 2, 3, 3, 4, 4, 5};
+#define SCROLL_ACCEL_COUNT (sizeof(scroll_accel) / sizeof(scroll_accel[0]))
+#define SCROLL_WHEEL_TICKS 3 /* wheel ticks per step */
+#define SCROLL_PAGES_MAX 2   /* Page Up/Down per event: each one is a full hold */
+
+static void hid_wheel(ClaudeRemoteState* state, int8_t delta) {
+    for(int link = 0; link < LinkCount; link++) {
+        if(!link_selected(state, link) || !state->link_up[link]) continue;
+        HID_LINK_CALL(state, link, mouse_scroll, delta);
+        state->stats.reports++;
+    }
+}
+
+/* Called for the Long event (repeats = 1) and for every Repeat event,
+ * whose coalesced repeats all count towards the acceleration. */
+static void scroll_step(ClaudeRemoteState* state, uint16_t repeats) {
+    uint32_t steps = 0;
+    while(repeats--) {
+        uint8_t i = state->scroll_repeats < SCROLL_ACCEL_COUNT ? state->scroll_repeats :
+                                                                 SCROLL_ACCEL_COUNT - 1;
+        steps += scroll_accel[i];
+        if(state->scroll_repeats < UINT8_MAX) state->scroll_repeats++;
+    }
+
+    if(state->scroll_mode == ScrollModeWheel) {
+        int32_t ticks = steps * SCROLL_WHEEL_TICKS;
+        while(ticks > 0) {
+            int8_t chunk = ticks > INT8_MAX ? INT8_MAX : ticks;
+            hid_wheel(state, state->scroll_dir > 0 ? chunk : -chunk);
+            ticks -= chunk;
+        }
+    } else {
+        if(steps > SCROLL_PAGES_MAX) steps = SCROLL_PAGES_MAX;
+        while(steps--) {
+            SEND_HID(state, state->scroll_dir > 0 ? HID_KEYBOARD_PAGE_UP : HID_KEYBOARD_PAGE_DOWN);
+        }
+    }
+    state->flash_label = state->scroll_dir > 0 ? "Scroll ^" : "Scroll v";
+    state->flash_tick = furi_get_tick();
+}
 
-#define DC_TIMEOUT_TICKS 300 /* ~300ms at 1kHz tick */
 #define FLASH_DURATION_TICKS 200 /* ~200ms visual feedback */
 
 /* ── Macro string sender (needs SEND_HID macro) ── */
@@ -973,150 +2713,1187 @@ static void send_macro_string(ClaudeRemoteState* state, const char* str) {
         uint16_t key = char_to_hid(*p);
         if(key != 0) {
             SEND_HID(state, key);
+            state->stats.bytes++;
             furi_delay_ms(20);
         }
     }
-    SEND_HID(state, HID_KEYBOARD_RETURN);
+    SEND_HID(state, HID_KEYBOARD_RETURN);
+    state->stats.macros++;
+}
+
+/* ── Macro usage ranking ── */
+
+static uint32_t fnv1a(const char* s) {
+    uint32_t hash = 0x811C9DC5U;
+    while(*s) {
+        hash ^= (uint8_t)*s++;
+        hash *= 0x01000193U;
+    }
+    return hash;
+}
+
+/* frecency: uses, decaying with the number of sends since the last one */
+static uint32_t macro_use_score(const MacroUseFile* file, const MacroUse* use) {
+    uint32_t age = file->seq - use->last;
+    return (uint32_t)use->count * 1024 / (age + 8);
+}
+
+static MacroUse* macro_use_find(MacroUseFile* file, uint32_t hash) {
+    for(uint8_t i = 0; i < MACRO_USE_MAX; i++) {
+        if(file->uses[i].count && file->uses[i].hash == hash) return &file->uses[i];
+    }
+    return NULL;
+}
+
+/* list order for the current set; selection stays put until the next load */
+static void macro_order_build(ClaudeRemoteState* state) {
+    uint32_t scores[MACRO_MAX_COUNT] = {0};
+    for(uint8_t i = 0; i < state->macro_count; i++) {
+        state->macro_order[i] = i;
+        MacroUse* use = state->macro_use_ready ?
+                            macro_use_find(&state->macro_use, fnv1a(state->macros[i])) :
+                            NULL;
+        if(use) scores[i] = macro_use_score(&state->macro_use, use);
+    }
+    if(state->macro_sort != MacroSortUsage) return;
+
+    /* insertion sort: stable, so ties keep file order */
+    for(uint8_t i = 1; i < state->macro_count; i++) {
+        uint8_t idx = state->macro_order[i];
+        uint8_t j = i;
+        while(j > 0 && scores[state->macro_order[j - 1]] < scores[idx]) {
+            state->macro_order[j] = state->macro_order[j - 1];
+            j--;
+        }
+        state->macro_order[j] = idx;
+    }
+}
+
+static void macro_use_loaded(ClaudeRemoteState* state, const StorageDone* done) {
+    MacroUseFile* file = &state->macro_use;
+    state->macro_use_on_sd = done->ok && done->bytes == sizeof(MacroUseFile) &&
+                             file->magic == MACRO_USE_MAGIC && file->version == MACRO_USE_VERSION;
+    if(!state->macro_use_on_sd) {
+        memset(file, 0, sizeof(MacroUseFile));
+        file->magic = MACRO_USE_MAGIC;
+        file->version = MACRO_USE_VERSION;
+    }
+    state->macro_use_ready = true;
+
+    /* the list may reorder under the cursor: stay on the same macro */
+    uint8_t keep = state->macro_count > 0 ? state->macro_order[state->macro_index] : 0;
+    macro_order_build(state);
+    for(uint8_t i = 0; i < state->macro_count; i++) {
+        if(state->macro_order[i] == keep) state->macro_index = i;
+    }
+}
+
+/* Counts a send. Only the changed record and the counter are written,
+ * each at its fixed offset; the whole file is written once, the first time.
+ * Every write carries its own copy, so later sends can't change what the
+ * worker has yet to write. */
+static void macro_use_record(ClaudeRemoteState* state, const char* text) {
+    if(!state->macro_use_ready) return;
+    MacroUseFile* file = &state->macro_use;
+    uint32_t hash = fnv1a(text);
+    MacroUse* use = macro_use_find(file, hash);
+    if(!use) {
+        /* a free slot, or else the lowest-scoring one */
+        use = &file->uses[0];
+        for(uint8_t i = 0; i < MACRO_USE_MAX && use->count; i++) {
+            MacroUse* u = &file->uses[i];
+            if(!u->count || macro_use_score(file, u) < macro_use_score(file, use)) use = u;
+        }
+        memset(use, 0, sizeof(MacroUse));
+        use->hash = hash;
+    }
+    if(use->count < UINT16_MAX) use->count++;
+    use->last = ++file->seq;
+
+    if(!state->macro_use_on_sd) {
+        MacroUseFile* copy = malloc(sizeof(MacroUseFile));
+        memcpy(copy, file, sizeof(MacroUseFile));
+        storage_write_owned(&state->io, MACRO_USE_PATH, copy, sizeof(MacroUseFile));
+        state->macro_use_on_sd = true;
+        return;
+    }
+    /* storage_patch() copies the bytes into the job */
+    storage_patch(
+        &state->io, MACRO_USE_PATH, offsetof(MacroUseFile, seq), &file->seq, sizeof(file->seq));
+    storage_patch(
+        &state->io,
+        MACRO_USE_PATH,
+        offsetof(MacroUseFile, uses) + (use - file->uses) * sizeof(MacroUse),
+        use,
+        sizeof(MacroUse));
+}
+
+/* ── Macro loader from SD ── */
+
+/* Macros opens at once with "Loading..."; the index arrives first, then
+ * the entries of the current set, read by their byte range */
+/* Refreshes the index on opening Macros and every MACRO_RECHECK_TICKS
+ * while it is open. The worker re-scans only files whose size or mtime
+ * changed, so when nothing did this costs one stat per file. */
+static void macros_request(ClaudeRemoteState* state) {
+    state->macro_check_tick = furi_get_tick();
+    if(state->macro_index_pending || state->macros_loading) return;
+    state->macro_index_pending = true;
+    if(!state->macro_sets_ready) state->macros_loading = true;
+    storage_index_macros(&state->io, malloc(sizeof(MacroIndex)));
+    if(!state->macro_use_ready) {
+        storage_read(
+            &state->io, StorageTagMacroUse, 0, MACRO_USE_PATH, 0, &state->macro_use,
+            sizeof(MacroUseFile));
+    }
+}
+
+/* reload keeps the current list and selection until the new entries are parsed */
+static void macro_set_load(ClaudeRemoteState* state, uint8_t set, bool reload) {
+    const MacroSetInfo* info = &state->macro_sets.sets[set];
+    char path[STORAGE_PATH_LEN];
+    if(info->root) {
+        snprintf(path, sizeof(path), "%s", MACROS_PATH);
+    } else {
+        snprintf(path, sizeof(path), "%s/%s.txt", MACROS_DIR, info->name);
+    }
+    uint16_t start = info->offsets[0];
+    uint16_t size = info->offsets[info->count] - start;
+    if(size > sizeof(state->macro_io) - 1) size = sizeof(state->macro_io) - 1;
+
+    state->macro_set = set;
+    memcpy(state->macro_set_name, info->name, sizeof(state->macro_set_name));
+    if(!reload) state->macro_index = 0;
+    state->macros_loading = true;
+    state->macro_reloading = reload;
+    storage_read(&state->io, StorageTagMacros, set, path, start, state->macro_io, size);
+}
+
+static void macro_sets_loaded(ClaudeRemoteState* state, const StorageDone* done) {
+    MacroIndex* index = done->buf;
+    bool first = !state->macro_sets_ready;
+    uint8_t set = 0;
+    bool found = false;
+    for(uint8_t i = 0; i < index->count; i++) {
+        if(strcmp(index->sets[i].name, state->macro_set_name) == 0) {
+            set = i;
+            found = true;
+        }
+    }
+    /* the set on screen is re-read only if its file changed */
+    bool changed = first || !found;
+    if(!changed) {
+        const MacroSetInfo* was = &state->macro_sets.sets[state->macro_set];
+        changed = was->size != index->sets[set].size || was->mtime != index->sets[set].mtime;
+    }
+
+    memcpy(&state->macro_sets, index, sizeof(MacroIndex));
+    free(index);
+    state->macro_index_pending = false;
+    state->macro_sets_ready = true;
+    state->macros_loading = false;
+    if(state->macro_sets.count == 0) {
+        state->macro_count = 0;
+        return;
+    }
+    state->macro_set = set;
+    if(changed) {
+        if(!first) FURI_LOG_I(TAG, "Macros: %s changed, reloading", state->macro_sets.sets[set].name);
+        macro_set_load(state, set, !first && found);
+    }
+}
+
+static void macros_parse(ClaudeRemoteState* state, const StorageDone* done) {
+    /* after an edit, stay on the same macro if it is still there */
+    char keep[MACRO_MAX_LEN + 1] = "";
+    if(state->macro_reloading && state->macro_count > 0) {
+        memcpy(keep, state->macros[state->macro_order[state->macro_index]], sizeof(keep));
+    }
+    state->macro_count = 0;
+    state->macros_loading = false;
+    state->macro_reloading = false;
+    state->macro_index = 0;
+
+    if(done->ok) {
+        char* buf = state->macro_io;
+        buf[done->bytes] = '\0';
+
+        char* p = buf;
+        while(*p && state->macro_count < MACRO_MAX_COUNT) {
+            char* line_start = p;
+            while(*p && *p != '\n' && *p != '\r') p++;
+
+            int len = p - line_start;
+            if(len > MACRO_MAX_LEN) len = MACRO_MAX_LEN;
+
+            if(len > 0) {
+                memcpy(state->macros[state->macro_count], line_start, len);
+                state->macros[state->macro_count][len] = '\0';
+                state->macro_count++;
+            }
+
+            while(*p == '\n' || *p == '\r') p++;
+        }
+    }
+    macro_order_build(state);
+    for(uint8_t i = 0; keep[0] && i < state->macro_count; i++) {
+        if(strcmp(state->macros[state->macro_order[i]], keep) == 0) state->macro_index = i;
+    }
+}
+
+/* ── Macro pins ── */
+
+/* until pins.txt has been written once */
+static const char* const macro_pin_defaults[MACRO_PIN_MAX] = {"/clear", "/compact", "/resume"};
+
+static void macro_pins_loaded(ClaudeRemoteState* state, const StorageDone* done) {
+    if(!done->ok) {
+        for(uint8_t i = 0; i < MACRO_PIN_MAX; i++) {
+            snprintf(state->macro_pins[i], MACRO_MAX_LEN + 1, "%s", macro_pin_defaults[i]);
+        }
+        return;
+    }
+
+    /* one pin per line, in pin order; an empty line leaves that pin unset */
+    char* p = state->pin_io;
+    p[done->bytes] = '\0';
+    for(uint8_t i = 0; i < MACRO_PIN_MAX && *p; i++) {
+        char* line = p;
+        while(*p && *p != '\n' && *p != '\r') p++;
+        size_t len = p - line;
+        if(len > MACRO_MAX_LEN) len = MACRO_MAX_LEN;
+        memcpy(state->macro_pins[i], line, len);
+        state->macro_pins[i][len] = '\0';
+        if(*p == '\r') p++;
+        if(*p == '\n') p++;
+    }
+}
+
+/* Pins text as pin 1, moving the others down one; pinning it again
+ * just brings it back to the front. */
+static void macro_pin(ClaudeRemoteState* state, const char* text) {
+    uint8_t from = MACRO_PIN_MAX - 1;
+    for(uint8_t i = 0; i < MACRO_PIN_MAX; i++) {
+        if(strcmp(state->macro_pins[i], text) == 0) {
+            from = i;
+            break;
+        }
+    }
+    memmove(state->macro_pins[1], state->macro_pins[0], from * (MACRO_MAX_LEN + 1));
+    snprintf(state->macro_pins[0], MACRO_MAX_LEN + 1, "%s", text);
+
+    char* out = malloc(MACRO_PIN_FILE_MAX + 1);
+    size_t len = 0;
+    for(uint8_t i = 0; i < MACRO_PIN_MAX; i++) {
+        len += snprintf(out + len, MACRO_PIN_FILE_MAX + 1 - len, "%s\n", state->macro_pins[i]);
+    }
+    storage_write_owned(&state->io, MACRO_PIN_PATH, out, len);
+    state->macro_pin_hint = true;
+}
+
+/* ── Gesture engine ── */
+
+#define OS_MAC (1U << 0)
+#define OS_WIN (1U << 1)
+#define OS_LINUX (1U << 2)
+#define OS_ANY (OS_MAC | OS_WIN | OS_LINUX)
+
+typedef struct {
+    uint8_t key;     /* InputKey */
+    uint8_t gesture; /* Gesture */
+    uint8_t os;      /* OS_* bits it applies to */
+    GestureAction action;
+} KeyBinding;
+
+#define KEYS1(a, label) {ActionKeys, 1, {a}, NULL, label}
+#define KEYS2(a, b, label) {ActionKeys, 2, {a, b}, NULL, label}
+
+static const KeyBinding default_bindings[] = {
+    {InputKeyLeft, GestureSingle, OS_ANY, KEYS1(HID_KEYBOARD_1, "1")},
+    {InputKeyUp, GestureSingle, OS_ANY, KEYS1(HID_KEYBOARD_2, "2")},
+    {InputKeyRight, GestureSingle, OS_ANY, KEYS1(HID_KEYBOARD_3, "3")},
+    {InputKeyOk, GestureSingle, OS_ANY, KEYS1(HID_KEYBOARD_RETURN, "Enter")},
+    {InputKeyDown, GestureSingle, OS_MAC | OS_LINUX,
+     {ActionConsumer, 1, {HID_CONSUMER_DICTATION}, NULL, "Dictate"}},
+    {InputKeyDown, GestureSingle, OS_WIN, KEYS1(HID_KEYBOARD_H | KEY_MOD_LEFT_GUI, "Voice")},
+    {InputKeyBack, GestureSingle, OS_ANY, {ActionHome, 0, {0}, NULL, ""}},
+
+    /* Ctrl+A (start of line) then Ctrl+K (kill to end) = clear entire line */
+    {InputKeyLeft, GestureDouble, OS_ANY,
+     KEYS2(HID_KEYBOARD_A | KEY_MOD_LEFT_CTRL, HID_KEYBOARD_K | KEY_MOD_LEFT_CTRL, "Clear")},
+    {InputKeyUp, GestureDouble, OS_ANY, KEYS1(HID_KEYBOARD_PAGE_UP, "Pg Up")},
+    {InputKeyRight, GestureDouble, OS_ANY, KEYS1(HID_KEYBOARD_UP_ARROW, "Prev Cmd")},
+    {InputKeyDown, GestureDouble, OS_ANY, KEYS1(HID_KEYBOARD_PAGE_DOWN, "Pg Down")},
+    {InputKeyOk, GestureDouble, OS_MAC, KEYS1(HID_KEYBOARD_GRAVE_ACCENT | KEY_MOD_LEFT_GUI, "Switch")},
+    {InputKeyOk, GestureDouble, OS_WIN | OS_LINUX, KEYS1(HID_KEYBOARD_TAB | KEY_MOD_LEFT_ALT, "Switch")},
+
+    {InputKeyOk, GestureTriple, OS_ANY, {ActionText, 0, {0}, "/compact", "Compact"}},
+
+    {InputKeyBack, GestureLong, OS_ANY, KEYS1(HID_KEYBOARD_ESCAPE, "Esc")},
+    {InputKeyOk, GestureLong, OS_ANY, {ActionStats, 0, {0}, NULL, ""}},
+    {InputKeyUp, GestureLong, OS_ANY, {ActionScrollUp, 0, {0}, NULL, ""}},
+    {InputKeyDown, GestureLong, OS_ANY, {ActionScrollDown, 0, {0}, NULL, ""}},
+#ifdef HID_TRANSPORT_BLE
+    {InputKeyLeft, GestureLong, OS_ANY, {ActionOutputNext, 0, {0}, NULL, ""}},
+    {InputKeyRight, GestureLong, OS_ANY, {ActionHostNext, 0, {0}, NULL, ""}},
+#endif
+
+    /* Back held + key */
+    {InputKeyLeft, GestureChord, OS_ANY, KEYS1(HID_KEYBOARD_C | KEY_MOD_LEFT_CTRL, "Ctrl+C")},
+    {InputKeyRight, GestureChord, OS_ANY, KEYS1(HID_KEYBOARD_TAB, "Tab")},
+    {InputKeyUp, GestureChord, OS_ANY, KEYS1(HID_KEYBOARD_TAB | KEY_MOD_LEFT_SHIFT, "Mode")},
+    {InputKeyDown, GestureChord, OS_ANY, {ActionKeymapNext, 0, {0}, NULL, ""}},
+
+    /* pinned macros, see macro_pin() */
+    {InputKeyOk, GestureChord, OS_ANY, {ActionPin, 0, {0}, NULL, ""}},
+#ifndef HID_TRANSPORT_BLE
+    {InputKeyLeft, GestureLong, OS_ANY, {ActionPin, 1, {0}, NULL, ""}},
+    {InputKeyRight, GestureLong, OS_ANY, {ActionPin, 2, {0}, NULL, ""}},
+#endif
+};
+
+static void keymap_defaults(Keymap* keymap, uint8_t os_mode) {
+    memset(keymap, 0, sizeof(Keymap));
+    for(size_t i = 0; i < COUNT_OF(default_bindings); i++) {
+        const KeyBinding* b = &default_bindings[i];
+        if(b->os & (1U << os_mode)) keymap->actions[b->key][b->gesture] = b->action;
+    }
+}
+
+/* a key with no double/triple binding fires on its first tap, with no window to wait out */
+static void keymap_finish(Keymap* keymap) {
+    for(int key = 0; key < InputKeyMAX; key++) {
+        keymap->max_taps[key] = 1;
+        for(int taps = 2; taps <= 3; taps++) {
+            if(keymap->actions[key][GestureSingle + taps - 1].kind != ActionNone) {
+                keymap->max_taps[key] = taps;
+            }
+        }
+    }
+}
+
+/* ── Keymap profiles from SD ── */
+
+typedef struct {
+    const char* name;
+    uint16_t code;
+} KeyName;
+
+static const KeyName keymap_buttons[] = {
+    {"up", InputKeyUp}, {"down", InputKeyDown}, {"right", InputKeyRight},
+    {"left", InputKeyLeft}, {"ok", InputKeyOk}, {"back", InputKeyBack},
+};
+
+static const KeyName keymap_gestures[] = {
+    {"single", GestureSingle}, {"double", GestureDouble}, {"triple", GestureTriple},
+    {"long", GestureLong}, {"chord", GestureChord},
+};
+
+static const KeyName keymap_internal[] = {
+    {"@home", ActionHome}, {"@stats", ActionStats}, {"@scroll-up", ActionScrollUp},
+    {"@scroll-down", ActionScrollDown}, {"@output", ActionOutputNext},
+    {"@host", ActionHostNext}, {"@keymap", ActionKeymapNext},
+};
+
+static const KeyName keymap_mods[] = {
+    {"ctrl", KEY_MOD_LEFT_CTRL}, {"shift", KEY_MOD_LEFT_SHIFT}, {"alt", KEY_MOD_LEFT_ALT},
+    {"gui", KEY_MOD_LEFT_GUI}, {"cmd", KEY_MOD_LEFT_GUI}, {"win", KEY_MOD_LEFT_GUI},
+};
+
+static const KeyName keymap_keys[] = {
+    {"enter", HID_KEYBOARD_RETURN}, {"esc", HID_KEYBOARD_ESCAPE}, {"tab", HID_KEYBOARD_TAB},
+    {"space", HID_KEYBOARD_SPACEBAR}, {"bksp", HID_KEYBOARD_DELETE},
+    {"del", HID_KEYBOARD_DELETE_FORWARD}, {"ins", HID_KEYBOARD_INSERT},
+    {"up", HID_KEYBOARD_UP_ARROW}, {"down", HID_KEYBOARD_DOWN_ARROW},
+    {"left", HID_KEYBOARD_LEFT_ARROW}, {"right", HID_KEYBOARD_RIGHT_ARROW},
+    {"pgup", HID_KEYBOARD_PAGE_UP}, {"pgdn", HID_KEYBOARD_PAGE_DOWN},
+    {"home", HID_KEYBOARD_HOME}, {"end", HID_KEYBOARD_END},
+};
+
+static bool key_name_find(const KeyName* names, size_t count, const char* name, uint16_t* code) {
+    for(size_t i = 0; i < count; i++) {
+        if(strcmp(names[i].name, name) == 0) {
+            *code = names[i].code;
+            return true;
+        }
+    }
+    return false;
+}
+
+/* splits off the next space-separated word, in place */
+static char* keymap_token(char** p) {
+    while(**p == ' ' || **p == '\t') (*p)++;
+    char* start = *p;
+    while(**p && **p != ' ' && **p != '\t') (*p)++;
+    if(**p) *(*p)++ = '\0';
+    return start;
+}
+
+/* "ctrl+shift+tab", "f5", "[" → report code, 0 if unknown */
+static uint16_t keymap_parse_combo(char* combo) {
+    uint16_t mods = 0;
+    char* plus;
+    while((plus = strchr(combo, '+')) != NULL && plus[1] != '\0') {
+        *plus = '\0';
+        uint16_t mod;
+        if(!key_name_find(keymap_mods, COUNT_OF(keymap_mods), combo, &mod)) return 0;
+        mods |= mod;
+        combo = plus + 1;
+    }
+    uint16_t key = 0;
+    if(key_name_find(keymap_keys, COUNT_OF(keymap_keys), combo, &key)) return key | mods;
+    if(combo[0] == 'f' && combo[1] >= '1' && combo[1] <= '9') {
+        uint16_t n = parse_u16(combo + 1);
+        return n >= 1 && n <= 12 ? (HID_KEYBOARD_F1 + n - 1) | mods : 0;
+    }
+    key = combo[1] == '\0' ? char_to_hid(combo[0]) : 0;
+    return key ? key | mods : 0;
+}
+
+/* One binding: "[mac:|win:|linux:] <button> <gesture> = <action> [: label]".
+ * Returns false for a line it couldn't make sense of. */
+static bool keymap_parse_line(Keymap* keymap, char* p, uint8_t os_mode, uint16_t* text_used) {
+    static const char* const os_prefix[] = {"mac:", "win:", "linux:"};
+    while(*p == ' ' || *p == '\t') p++;
+    if(*p == '\0' || *p == '#') return true;
+    for(uint8_t os = 0; os < COUNT_OF(os_prefix); os++) {
+        size_t len = strlen(os_prefix[os]);
+        if(strncmp(p, os_prefix[os], len) == 0) {
+            if(os != os_mode) return true;
+            p += len;
+        }
+    }
+
+    uint16_t key, gesture;
+    if(!key_name_find(keymap_buttons, COUNT_OF(keymap_buttons), keymap_token(&p), &key)) return false;
+    if(!key_name_find(keymap_gestures, COUNT_OF(keymap_gestures), keymap_token(&p), &gesture)) {
+        return false;
+    }
+    /* Back is the chord key and goes Home without waiting for more taps */
+    if(key == InputKeyBack && gesture != GestureSingle && gesture != GestureLong) return false;
+    if(strcmp(keymap_token(&p), "=") != 0) return false;
+    while(*p == ' ' || *p == '\t') p++;
+
+    GestureAction action = {0};
+    const char* label = "";
+    if(*p == '"') {
+        char* text = ++p;
+        while(*p && *p != '"') p++;
+        if(*p == '\0') return false;
+        *p++ = '\0';
+        size_t len = strlen(text);
+        if(len == 0 || len > MACRO_MAX_LEN || *text_used + len + 1 > KEYMAP_TEXT_LEN) return false;
+        memcpy(keymap->text + *text_used, text, len + 1);
+        action.kind = ActionText;
+        action.text = keymap->text + *text_used;
+        *text_used += len + 1;
+        label = text;
+    } else {
+        char* word = keymap_token(&p);
+        uint16_t kind;
+        if(strcmp(word, "none") == 0) {
+            action.kind = ActionNone;
+        } else if(strcmp(word, "dictate") == 0) {
+            action.kind = ActionConsumer;
+            action.codes[action.count++] = HID_CONSUMER_DICTATION;
+            label = "Dictate";
+        } else if(key_name_find(keymap_internal, COUNT_OF(keymap_internal), word, &kind)) {
+            action.kind = kind;
+        } else if(strncmp(word, "@pin", 4) == 0) {
+            /* @pin1 .. @pin3 */
+            if(word[4] < '1' || word[4] >= '1' + MACRO_PIN_MAX || word[5] != '\0') return false;
+            action.kind = ActionPin;
+            action.count = word[4] - '1';
+        } else {
+            if(*word == '\0') return false;
+            action.kind = ActionKeys;
+            label = word; /* first combo, as written */
+            for(;;) {
+                if(action.count == ACTION_KEYS_MAX) return false;
+                char combo[24];
+                snprintf(combo, sizeof(combo), "%s", word);
+                uint16_t code = keymap_parse_combo(combo);
+                if(code == 0) return false;
+                action.codes[action.count++] = code;
+                while(*p == ' ' || *p == '\t') p++;
+                if(*p == '\0' || *p == ':') break;
+                word = keymap_token(&p);
+            }
+        }
+    }
+
+    while(*p == ' ' || *p == '\t') p++;
+    if(*p == ':') {
+        p++;
+        while(*p == ' ' || *p == '\t') p++;
+        char* end = p + strlen(p);
+        while(end > p && (end[-1] == ' ' || end[-1] == '\t')) *--end = '\0';
+        label = p;
+    }
+    snprintf(action.label, sizeof(action.label), "%s", label);
+    keymap->actions[key][gesture] = action;
+    return true;
+}
+
+/* applies a profile's text on top of the defaults already in keymap */
+static void keymap_parse(Keymap* keymap, char* buf, const char* name, uint8_t os_mode) {
+    uint16_t text_used = 0;
+    uint16_t line_no = 0;
+    char* p = buf;
+    while(*p) {
+        char* line = p;
+        while(*p && *p != '\n') p++;
+        if(*p) *p++ = '\0';
+        line_no++;
+        char* cr = strchr(line, '\r');
+        if(cr) *cr = '\0';
+        if(!keymap_parse_line(keymap, line, os_mode, &text_used)) {
+            FURI_LOG_W(TAG, "Keymap %s:%u not understood", name, line_no);
+        }
+    }
+}
+
+/* lists keymaps/<name>.txt by name, sorted, after the built-in profile */
+static void keymap_scan(ClaudeRemoteState* state) {
+    snprintf(state->keymap_names[0], sizeof(state->keymap_names[0]), "Claude");
+    state->keymap_count = 1;
+
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* dir = storage_file_alloc(storage);
+
+    if(storage_dir_open(dir, KEYMAPS_DIR)) {
+        FileInfo info;
+        char name[32];
+        while(state->keymap_count < KEYMAP_MAX &&
+              storage_dir_read(dir, &info, name, sizeof(name))) {
+            size_t len = strlen(name);
+            if(file_info_is_dir(&info) || len < 5 || strcmp(name + len - 4, ".txt") != 0) continue;
+            len -= 4;
+            if(len > KEYMAP_NAME_LEN) continue; /* wouldn't open again under a cut name */
+
+            uint8_t i = state->keymap_count++;
+            while(i > 1 && strcmp(state->keymap_names[i - 1], name) > 0) {
+                memcpy(state->keymap_names[i], state->keymap_names[i - 1], KEYMAP_NAME_LEN + 1);
+                i--;
+            }
+            memcpy(state->keymap_names[i], name, len);
+            state->keymap_names[i][len] = '\0';
+        }
+    }
+
+    storage_dir_close(dir);
+    storage_file_free(dir);
+    furi_record_close(RECORD_STORAGE);
+}
+
+/* Builds a profile into the spare table, then points dispatch at it.
+ * The tap in flight has already been flushed against the old table.
+ * text is the profile file (NULL for the built-in one) and is freed here. */
+static void keymap_build(ClaudeRemoteState* state, uint8_t index, char* text) {
+    Keymap* next = state->keymap == &state->keymaps[0] ? &state->keymaps[1] : &state->keymaps[0];
+    keymap_defaults(next, state->os_mode);
+    if(text) keymap_parse(next, text, state->keymap_names[index], state->os_mode);
+    keymap_finish(next);
+    state->keymap = next;
+    state->keymap_index = index;
+    free(text);
+    FURI_LOG_I(TAG, "Keymap: %s", state->keymap_names[index]);
+}
+
+/* the built-in profile switches at once; SD ones once the worker has read them */
+static void keymap_select(ClaudeRemoteState* state, uint8_t index) {
+    state->keymap_want = index;
+    if(index == 0) {
+        keymap_build(state, 0, NULL);
+        return;
+    }
+    char path[STORAGE_PATH_LEN];
+    snprintf(path, sizeof(path), "%s/%s.txt", KEYMAPS_DIR, state->keymap_names[index]);
+    storage_read(
+        &state->io, StorageTagKeymap, index, path, 0, malloc(KEYMAP_FILE_MAX), KEYMAP_FILE_MAX - 1);
+}
+
+static void keymap_loaded(ClaudeRemoteState* state, const StorageDone* done) {
+    char* text = done->buf;
+    if(done->arg != state->keymap_want) {
+        free(text); /* superseded by a later switch */
+        return;
+    }
+    if(done->ok) {
+        text[done->bytes] = '\0';
+    } else {
+        FURI_LOG_W(TAG, "Keymap %s unreadable", state->keymap_names[done->arg]);
+        free(text);
+        text = NULL;
+    }
+    keymap_build(state, done->arg, text);
+    state->flash_label = state->keymap_names[state->keymap_index];
+    state->flash_tick = furi_get_tick();
 }
 
-/* ── Macro loader from SD ── */
+/* ── Quiz bank ── */
 
-static void load_macros_from_sd(ClaudeRemoteState* state) {
-    state->macro_count = 0;
-    state->macros_loaded = true;
+/* reads the quiz.bank header; a round started before it arrives uses the
+ * built-in cards */
+static void quiz_bank_check(ClaudeRemoteState* state) {
+    if(state->quiz_bank_pending) return;
+    state->quiz_bank_pending = true;
+    storage_read(
+        &state->io, StorageTagQuizBank, 0, QUIZ_BANK_PATH, 0, &state->quiz_bank_head,
+        sizeof(QuizBankHeader));
+}
 
-    Storage* storage = furi_record_open(RECORD_STORAGE);
-    File* file = storage_file_alloc(storage);
+static void quiz_bank_loaded(ClaudeRemoteState* state, const StorageDone* done) {
+    const QuizBankHeader* head = &state->quiz_bank_head;
+    state->quiz_bank_pending = false;
+    uint16_t count = 0;
+    if(done->ok && done->bytes == sizeof(QuizBankHeader) && head->magic == QUIZ_BANK_MAGIC &&
+       head->version == QUIZ_BANK_VERSION) {
+        count = head->count > UINT16_MAX ? UINT16_MAX : head->count;
+        state->quiz_bank_id = head->id;
+    }
+    if(count != state->quiz_bank_count) FURI_LOG_I(TAG, "quiz.bank: %u cards", count);
+    state->quiz_bank_count = count;
+}
 
-    if(storage_file_open(file, MACROS_PATH, FSAM_READ, FSOM_OPEN_EXISTING)) {
-        char buf[512];
-        uint16_t bytes_read = storage_file_read(file, buf, sizeof(buf) - 1);
-        buf[bytes_read] = '\0';
+/* the current question, or NULL while its bank record is still loading */
+static const QuizCard* quiz_current(const ClaudeRemoteState* state) {
+    if(state->quiz_scanning) return NULL;
+    uint16_t id = state->quiz_order[state->quiz_index];
+    if(!state->quiz_from_bank) return &quiz_cards[id];
+    if(!state->quiz_record_ready || state->quiz_record_id != id) return NULL;
+    return &state->quiz_bank_card;
+}
 
-        char* p = buf;
-        while(*p && state->macro_count < MACRO_MAX_COUNT) {
-            char* line_start = p;
-            while(*p && *p != '\n' && *p != '\r') p++;
+/* the current question's pre-wrapped lines; quiz_current() must be non-NULL */
+static const LayoutLine* quiz_current_lines(const ClaudeRemoteState* state, uint8_t* count) {
+    uint16_t id = state->quiz_order[state->quiz_index];
+    if(!state->quiz_from_bank) {
+        *count = quiz_line_first[id + 1] - quiz_line_first[id];
+        return &quiz_lines[quiz_line_first[id]];
+    }
+    const QuizRecordHead* head = (const QuizRecordHead*)state->quiz_record;
+    *count = head->line_count;
+    return (const LayoutLine*)(head + 1);
+}
 
-            int len = p - line_start;
-            if(len > MACRO_MAX_LEN) len = MACRO_MAX_LEN;
+/* queues a read of the current bank card, unless it is loaded or a read
+ * is already out (its completion asks again) */
+static void quiz_card_request(ClaudeRemoteState* state) {
+    if(!state->quiz_from_bank || state->quiz_scanning || state->quiz_index >= state->quiz_count ||
+       state->quiz_record_pending) {
+        return;
+    }
+    uint16_t id = state->quiz_order[state->quiz_index];
+    if(state->quiz_record_ready && state->quiz_record_id == id) return;
+    state->quiz_record_id = id;
+    state->quiz_record_ready = false;
+    state->quiz_record_pending = true;
+    storage_read_record(
+        &state->io, StorageTagQuizCard, QUIZ_BANK_PATH,
+        sizeof(QuizBankHeader) + (uint32_t)id * sizeof(StorageRecord), state->quiz_record,
+        sizeof(state->quiz_record));
+}
 
-            if(len > 0) {
-                memcpy(state->macros[state->macro_count], line_start, len);
-                state->macros[state->macro_count][len] = '\0';
-                state->macro_count++;
-            }
+/* checks the record in quiz_record and points quiz_bank_card into it */
+static bool quiz_record_parse(ClaudeRemoteState* state, uint16_t bytes) {
+    const QuizRecordHead* head = (const QuizRecordHead*)state->quiz_record;
+    if(bytes < sizeof(QuizRecordHead) || head->correct_option > 2) return false;
+    size_t pos = sizeof(QuizRecordHead) + head->line_count * sizeof(LayoutLine);
+    const char* text = (const char*)state->quiz_record;
+    const char* fields[5];
+    for(uint8_t i = 0; i < 5; i++) {
+        const char* nul = pos < bytes ? memchr(text + pos, '\0', bytes - pos) : NULL;
+        if(!nul) return false;
+        fields[i] = text + pos;
+        pos = nul - text + 1;
+    }
+    /* the question is drawn through layout_line_text(): plain ASCII, and
+     * every span inside it */
+    size_t length = strlen(fields[0]);
+    for(size_t i = 0; i < length; i++) {
+        if((uint8_t)fields[0][i] >= 0x80) return false;
+    }
+    const LayoutLine* lines = (const LayoutLine*)(head + 1);
+    for(uint8_t i = 0; i < head->line_count; i++) {
+        if(lines[i].offset + lines[i].length > length) return false;
+    }
+    state->quiz_bank_card = (QuizCard){
+        QuizTypeMultiChoice, fields[0], fields[1], fields[2], fields[3], fields[4],
+        head->correct_option};
+    return true;
+}
 
-            while(*p == '\n' || *p == '\r') p++;
+static void quiz_card_loaded(ClaudeRemoteState* state, const StorageDone* done) {
+    state->quiz_record_pending = false;
+    if(!done->ok || !quiz_record_parse(state, done->bytes)) {
+        /* the file changed or is damaged: finish the round from the built-in cards */
+        FURI_LOG_W(TAG, "quiz.bank record %u unreadable", state->quiz_record_id);
+        state->quiz_bank_count = 0;
+        if(state->quiz_from_bank) {
+            state->quiz_from_bank = false;
+            state->quiz_boxes_ready = false;
+            state->quiz_count = quiz_sample(state, state->quiz_count, QUIZ_CARD_COUNT);
         }
+        return;
     }
+    state->quiz_record_ready = true;
+    quiz_card_request(state); /* the round may have moved on while this loaded */
+}
 
-    storage_file_close(file);
-    storage_file_free(file);
-    furi_record_close(RECORD_STORAGE);
+static const char* quiz_boxes_path(bool bank) {
+    return bank ? QUIZ_BANK_BOXES_PATH : QUIZ_BOXES_PATH;
 }
 
-static void flush_pending_single(ClaudeRemoteState* state) {
-    if(!state->dc_pending) return;
-    state->dc_pending = false;
-    if(!state->hid_connected) return;
+/* the built-in cards' set id, for quiz.boxes: changes when the cards do */
+static uint32_t quiz_builtin_source(void) {
+    uint32_t source = QUIZ_CARD_COUNT;
+    for(uint8_t i = 0; i < QUIZ_CARD_COUNT; i++) {
+        source = source * 16777619U ^ fnv1a(quiz_cards[i].description);
+    }
+    return source;
+}
 
-    const char* label = NULL;
-    switch(state->dc_key) {
-    case InputKeyLeft:
-        SEND_HID(state, HID_KEYBOARD_1);
-        label = "1";
-        FURI_LOG_I(TAG, "Sent: 1");
+/* the worker picks the round's cards that are due, see quiz_scan_run() */
+static void quiz_scan_begin(ClaudeRemoteState* state) {
+    bool bank = state->quiz_from_bank;
+    state->quiz_scan_pending = true;
+    QuizScan* scan = &state->quiz_scan;
+    scan->source = bank ? state->quiz_bank_id : quiz_builtin_source();
+    scan->total = bank ? state->quiz_bank_count : QUIZ_CARD_COUNT;
+    scan->want = state->quiz_count;
+    storage_scan_quiz(&state->io, quiz_boxes_path(bank), state->quiz_seq, scan);
+}
+
+static void quiz_scan_loaded(ClaudeRemoteState* state, const StorageDone* done) {
+    const QuizScan* scan = &state->quiz_scan;
+    state->quiz_scan_pending = false;
+    if(state->quiz_start_queued) {
+        /* a round started while this scan ran; this one is stale */
+        state->quiz_start_queued = false;
+        if(state->quiz_scanning) quiz_scan_begin(state);
+        return;
+    }
+    if(done->arg != state->quiz_seq || !state->quiz_scanning) return; /* left since */
+    state->quiz_scanning = false;
+    state->quiz_count = scan->count;
+    memcpy(state->quiz_order, scan->ids, sizeof(scan->ids));
+    memcpy(state->quiz_boxes, scan->boxes, sizeof(scan->boxes));
+    state->quiz_round = scan->round;
+    state->quiz_boxes_ready = true;
+    uint16_t next = scan->round + 1;
+    storage_patch(
+        &state->io, quiz_boxes_path(state->quiz_from_bank), offsetof(QuizBoxHeader, round), &next,
+        sizeof(next));
+    quiz_card_request(state);
+}
+
+/* Moves the current card between boxes: right one box up and back in
+ * twice as many rounds, wrong back to box 1 and the next round. Saved with
+ * one 4-byte write at the card's offset. */
+static void quiz_box_record(ClaudeRemoteState* state, bool right) {
+    static const uint8_t intervals[QUIZ_BOX_MAX + 1] = {0, 1, 2, 4, 8, 16};
+    if(!state->quiz_boxes_ready) return;
+    QuizBox* box = &state->quiz_boxes[state->quiz_index];
+    if(right) {
+        box->box = box->box < 1 ? 2 : box->box < QUIZ_BOX_MAX ? box->box + 1 : QUIZ_BOX_MAX;
+    } else {
+        box->box = 1;
+    }
+    box->due = state->quiz_round + intervals[box->box];
+    box->last = right ? QuizResultRight : QuizResultWrong;
+    storage_patch(
+        &state->io, quiz_boxes_path(state->quiz_from_bank),
+        sizeof(QuizBoxHeader) + (uint32_t)state->quiz_order[state->quiz_index] * sizeof(QuizBox),
+        box, sizeof(QuizBox));
+}
+
+static void storage_complete(ClaudeRemoteState* state, const StorageDone* done) {
+    switch(done->tag) {
+    case StorageTagMacros:
+        macros_parse(state, done);
         break;
-    case InputKeyUp:
-        SEND_HID(state, HID_KEYBOARD_2);
-        label = "2";
-        FURI_LOG_I(TAG, "Sent: 2");
+    case StorageTagMacroIndex:
+        macro_sets_loaded(state, done);
         break;
-    case InputKeyRight:
-        SEND_HID(state, HID_KEYBOARD_3);
-        label = "3";
-        FURI_LOG_I(TAG, "Sent: 3");
+    case StorageTagMacroUse:
+        macro_use_loaded(state, done);
         break;
-    case InputKeyOk:
-        SEND_HID(state, HID_KEYBOARD_RETURN);
-        label = "Enter";
-        FURI_LOG_I(TAG, "Sent: Enter");
+    case StorageTagMacroPins:
+        macro_pins_loaded(state, done);
         break;
-    case InputKeyDown:
-        if(state->os_mode == 1) {
-            SEND_HID(state, HID_KEYBOARD_H | KEY_MOD_LEFT_GUI);
-            label = "Voice";
-            FURI_LOG_I(TAG, "Sent: Win+H (Windows Voice Typing)");
-        } else {
-            SEND_CONSUMER(state, HID_CONSUMER_DICTATION);
-            label = "Dictate";
-            FURI_LOG_I(TAG, "Sent: Dictation (consumer 0x00CF)");
-        }
+    case StorageTagKeymap:
+        keymap_loaded(state, done);
+        break;
+    case StorageTagQuizBank:
+        quiz_bank_loaded(state, done);
+        break;
+    case StorageTagQuizCard:
+        quiz_card_loaded(state, done);
+        break;
+    case StorageTagQuizScan:
+        quiz_scan_loaded(state, done);
+        break;
+    case StorageTagSettings:
+        settings_written(state, done);
         break;
     default:
         break;
     }
-    if(label) {
-        state->flash_label = label;
+}
+
+static void action_run(
+    ClaudeRemoteState* state,
+    const GestureAction* action,
+    Gesture gesture,
+    uint32_t since,
+    ViewPort* view_port) {
+    switch(action->kind) {
+    case ActionNone:
+        return;
+    case ActionHome:
+        /* discard whatever is still waiting, don't send it */
+        state->gesture.pending = InputKeyMAX;
+        memset(state->gesture.taps, 0, sizeof(state->gesture.taps));
+        state->scroll_dir = 0;
+        state->mode = ModeHome;
+        notify_led(state, LedOrange);
+        view_port_set_orientation(view_port, ViewPortOrientationVertical);
+        return;
+    case ActionStats:
+        state->stats_visible = true;
+        state->stats_page = 0;
+        return;
+    case ActionScrollUp:
+    case ActionScrollDown:
+        if(!state->hid_connected) return;
+        state->scroll_dir = action->kind == ActionScrollUp ? 1 : -1;
+        state->scroll_repeats = 0;
+        scroll_step(state, 1);
+        return;
+    case ActionOutputNext:
+#ifdef HID_TRANSPORT_BLE
+    {
+        HidOutput next = state->output == HidOutputUsb ? HidOutputBle :
+                         state->output == HidOutputBle ? HidOutputBoth :
+                                                         HidOutputUsb;
+        hid_select(state, next);
+        state->flash_label = next == HidOutputBoth ? "USB+BT" : next == HidOutputBle ? "BT" : "USB";
+        state->flash_tick = furi_get_tick();
+    }
+#endif
+        return;
+    case ActionHostNext:
+#ifdef HID_TRANSPORT_BLE
+        if(!(state->output & HidOutputBle) || state->host_count < 2) return;
+        hid_host_switch(state, (state->host_slot + 1) % state->host_count);
+        link_refresh(state);
+        state->flash_label = state->host_names[state->host_slot];
+        state->flash_tick = furi_get_tick();
+#endif
+        return;
+    case ActionKeymapNext:
+        keymap_select(state, (state->keymap_want + 1) % state->keymap_count);
+        settings_changed(state);
+        state->flash_label = state->keymap_names[state->keymap_want];
         state->flash_tick = furi_get_tick();
-        if(state->haptics_enabled) {
-            notification_message(state->notifications, &sequence_single_vibro);
+        return;
+    case ActionKeys:
+    case ActionConsumer:
+    case ActionText:
+    case ActionPin:
+        break;
+    }
+
+    if(!state->hid_connected) return;
+    /* for taps this includes the multi-tap window, the dominant delay */
+    stats_hist_add(&state->stats.press_to_send, furi_get_tick() - since);
+
+    const char* label = action->label;
+    if(action->kind == ActionText) {
+        send_macro_string(state, action->text);
+    } else if(action->kind == ActionPin) {
+        label = state->macro_pins[action->count];
+        if(*label == '\0') return;
+        send_macro_string(state, label);
+    } else if(action->kind == ActionConsumer) {
+        SEND_CONSUMER(state, action->codes[0]);
+    } else {
+        for(uint8_t i = 0; i < action->count; i++) {
+            if(i) furi_delay_ms(ACTION_KEY_GAP_MS);
+            SEND_HID(state, action->codes[i]);
         }
     }
+    FURI_LOG_I(TAG, "Gesture %d: %s", gesture, label);
+
+    state->flash_label = label;
+    state->flash_tick = furi_get_tick();
+    notify_haptic(
+        state, gesture == GestureDouble || gesture == GestureTriple ? HapticDouble : HapticSingle);
 }
 
-static void send_double_action(ClaudeRemoteState* state, InputKey key) {
-    if(!state->hid_connected) return;
+static void gesture_fire(
+    ClaudeRemoteState* state,
+    InputKey key,
+    Gesture gesture,
+    uint32_t since,
+    ViewPort* view_port) {
+    action_run(state, &state->keymap->actions[key][gesture], gesture, since, view_port);
+}
 
-    const char* label = NULL;
-    switch(key) {
-    case InputKeyLeft:
-        /* Ctrl+A (start of line) then Ctrl+K (kill to end) = clear entire line */
-        SEND_HID(state, HID_KEYBOARD_A | KEY_MOD_LEFT_CTRL);
-        furi_delay_ms(30);
-        SEND_HID(state, HID_KEYBOARD_K | KEY_MOD_LEFT_CTRL);
-        label = "Clear";
-        FURI_LOG_I(TAG, "Double: Ctrl+A,Ctrl+K (clear entire line)");
-        break;
-    case InputKeyUp:
-        SEND_HID(state, HID_KEYBOARD_PAGE_UP);
-        label = "Pg Up";
-        FURI_LOG_I(TAG, "Double: Page Up");
-        break;
-    case InputKeyRight:
-        SEND_HID(state, HID_KEYBOARD_UP_ARROW);
-        label = "Prev Cmd";
-        FURI_LOG_I(TAG, "Double: Up Arrow (prev command)");
-        break;
-    case InputKeyOk:
-        if(state->os_mode == 0) {
-            SEND_HID(state, HID_KEYBOARD_GRAVE_ACCENT | KEY_MOD_LEFT_GUI);
-            label = "Switch";
-            FURI_LOG_I(TAG, "Double: Cmd+` (switch window)");
-        } else {
-            SEND_HID(state, HID_KEYBOARD_TAB | KEY_MOD_LEFT_ALT);
-            label = "Switch";
-            FURI_LOG_I(TAG, "Double: Alt+Tab (switch window)");
+/* send the waiting key as a single/double/triple, depending on its tap count */
+static void gesture_flush(ClaudeRemoteState* state, ViewPort* view_port) {
+    GestureState* g = &state->gesture;
+    InputKey key = g->pending;
+    if(key == InputKeyMAX) return;
+    g->pending = InputKeyMAX;
+    uint8_t taps = g->taps[key];
+    g->taps[key] = 0;
+    gesture_fire(state, key, GestureSingle + taps - 1, g->first_tick[key], view_port);
+}
+
+static void gesture_tap(ClaudeRemoteState* state, InputKey key, ViewPort* view_port) {
+    GestureState* g = &state->gesture;
+    uint32_t now = furi_get_tick();
+    if(g->pending != key || now - g->last_tick[key] >= g->tap_ms) {
+        gesture_flush(state, view_port);
+        g->first_tick[key] = now;
+    }
+    g->taps[key]++;
+    g->last_tick[key] = now;
+    g->pending = key;
+    if(g->taps[key] >= state->keymap->max_taps[key]) gesture_flush(state, view_port);
+}
+
+/* ms until the waiting key's window closes, or FuriWaitForever */
+static uint32_t gesture_timeout(const ClaudeRemoteState* state) {
+    const GestureState* g = &state->gesture;
+    if(g->pending == InputKeyMAX) return FuriWaitForever;
+    uint32_t elapsed = furi_get_tick() - g->last_tick[g->pending];
+    return elapsed >= g->tap_ms ? 0 : g->tap_ms - elapsed;
+}
+
+/* Press/Release only matter for Back, to spot chords; everything else
+ * acts on Short and Long. Back's own long press waits for the release
+ * so a key pressed late in the hold still makes a chord, not Esc. */
+static void gesture_input(ClaudeRemoteState* state, const InputRecord* event, ViewPort* view_port) {
+    GestureState* g = &state->gesture;
+    InputKey key = event->key;
+
+    if(key == InputKeyBack) {
+        switch(event->type) {
+        case InputTypePress:
+            g->back_held = true;
+            g->back_long = false;
+            g->chorded = false;
+            break;
+        case InputTypeLong:
+            g->back_long = true;
+            break;
+        case InputTypeRelease:
+            g->back_held = false;
+            if(g->back_long && !g->chorded) {
+                state->stats.presses++;
+                gesture_flush(state, view_port);
+                gesture_fire(state, key, GestureLong, furi_get_tick(), view_port);
+            }
+            break;
+        case InputTypeShort:
+            /* no taps counted: a waiting key is dropped by Home rather than sent */
+            if(!g->chorded) gesture_fire(state, key, GestureSingle, furi_get_tick(), view_port);
+            break;
+        default:
+            break;
         }
-        break;
-    case InputKeyDown:
-        SEND_HID(state, HID_KEYBOARD_PAGE_DOWN);
-        label = "Pg Down";
-        FURI_LOG_I(TAG, "Double: Page Down");
-        break;
-    default:
-        break;
+        return;
     }
-    if(label) {
-        state->flash_label = label;
-        state->flash_tick = furi_get_tick();
-        if(state->haptics_enabled) {
-            notification_message(state->notifications, &sequence_double_vibro);
+
+    if(event->type != InputTypeShort && event->type != InputTypeLong) return;
+    state->stats.presses++;
+    if(g->back_held) {
+        g->chorded = true;
+        gesture_flush(state, view_port);
+        gesture_fire(state, key, GestureChord, furi_get_tick(), view_port);
+    } else if(event->type == InputTypeLong) {
+        gesture_flush(state, view_port);
+        gesture_fire(state, key, GestureLong, furi_get_tick(), view_port);
+    } else {
+        gesture_tap(state, key, view_port);
+    }
+}
+
+/* ── Render snapshot publish / acquire ── */
+
+static void render_fill(const ClaudeRemoteState* state, RenderSnapshot* snap) {
+    snap->mode = state->mode;
+    snap->manual_view = state->manual_view;
+    snap->manual_dense = state->manual_dense;
+    snap->hid_connected = state->hid_connected;
+    memcpy(snap->link_up, state->link_up, sizeof(snap->link_up));
+#ifdef HID_TRANSPORT_BLE
+    snap->output = state->output;
+    memcpy(snap->host_name, state->host_names[state->host_slot], sizeof(snap->host_name));
+    snap->host_switching = state->host_switching;
+    snap->host_switch_tick = state->host_switch_tick;
+    snap->host_ready_tick = state->host_ready_tick;
+    snap->host_ready_ms = state->host_ready_ms;
+#endif
+    snap->link_since = state->link_since;
+    snap->flash_tick = state->flash_tick;
+    snprintf(snap->flash_label, sizeof(snap->flash_label), "%s",
+             state->flash_label ? state->flash_label : "");
+
+    snap->cat_index = state->cat_index;
+    snap->section_index = state->section_index;
+    snap->scroll_offset = state->scroll_offset;
+
+    /* the current card as text, so drawing never reads a record the worker
+     * may be refilling */
+    snap->quiz_ready = false;
+    if(state->mode == ModeManual && state->manual_view == ManualViewQuiz &&
+       !state->quiz_selecting && state->quiz_index < state->quiz_count) {
+        const QuizCard* card = quiz_current(state);
+        if(card) {
+            uint8_t count;
+            const LayoutLine* lines = quiz_current_lines(state, &count);
+            for(uint8_t i = 0; i < QUIZ_QUESTION_LINES; i++) {
+                snap->quiz_question[i][0] = '\0';
+                if(i < count) {
+                    layout_line_text(
+                        card->description, &lines[i], 0, snap->quiz_question[i],
+                        sizeof(snap->quiz_question[i]));
+                }
+            }
+            snprintf(snap->quiz_answer, sizeof(snap->quiz_answer), "%s", card->command);
+            const char* opts[3] = {card->option_a, card->option_b, card->option_c};
+            for(uint8_t i = 0; i < 3; i++) {
+                snprintf(snap->quiz_options[i], sizeof(snap->quiz_options[i]), "%s", opts[i]);
+            }
+            snap->quiz_correct_option = card->correct_option;
+            snap->quiz_ready = true;
+        }
+    }
+    snap->quiz_bank_count = state->quiz_bank_count;
+    snap->quiz_index = state->quiz_index;
+    snap->quiz_count = state->quiz_count;
+    snap->quiz_correct = state->quiz_correct;
+    snap->quiz_total = state->quiz_total;
+    snap->quiz_streak = state->quiz_streak;
+    snap->quiz_best_streak = state->quiz_best_streak;
+    snap->quiz_selected = state->quiz_selected;
+    snap->quiz_answered = state->quiz_answered;
+    snap->quiz_selecting = state->quiz_selecting;
+
+    memcpy(snap->search_query, state->search_query, sizeof(snap->search_query));
+    snap->search_char = state->search_char;
+    memcpy(snap->search_hits, state->search_hits, sizeof(snap->search_hits));
+    snap->search_hit_count = state->search_hit_count;
+    snap->search_hit_index = state->search_hit_index;
+    snap->search_in_hits = state->search_in_hits;
+
+    snap->stats_visible = state->stats_visible;
+    snap->stats_page = state->stats_page;
+    snap->rtt_phase = state->rtt.phase;
+    snap->rtt_toggles = state->rtt.toggles;
+    if(state->stats_visible) snap->stats = state->stats;
+    memcpy(snap->hold_ms, state->hold_ms, sizeof(snap->hold_ms));
+#ifdef HID_TRANSPORT_BLE
+    snap->host_slot = state->host_slot;
+    snap->host_count = state->host_count;
+    memcpy(snap->host_names, state->host_names, sizeof(snap->host_names));
+#endif
+#ifdef DIAG_MEMORY
+    const DiagMemory* diag = &state->diag;
+    snap->diag = (DiagCounts){
+        .main_stack_used = diag->main_stack_size - diag->main_stack_free,
+        .draw_stack_max = diag->draw_stack_max,
+        .gui_stack_free = diag->gui_stack_free,
+        .heap_app = diag->heap_app,
+        .heap_free = diag->heap_free,
+        .heap_min_free = diag->heap_min_free,
+        .screens_seen = diag->screens_seen,
+    };
+#endif
+#ifdef PROFILE_CYCLES
+    memcpy(snap->prof, prof_stats, sizeof(snap->prof));
+#endif
+
+    snap->haptics_enabled = state->haptics_enabled;
+    snap->led_enabled = state->led_enabled;
+    snap->os_mode = state->os_mode;
+    snap->scroll_mode = state->scroll_mode;
+    snap->tap_ms = state->gesture.tap_ms;
+    snap->macro_sort = state->macro_sort;
+    snap->settings_index = state->settings_index;
+
+    snap->macro_count = state->macro_count;
+    snap->macros_loading = state->macros_loading && !state->macro_reloading;
+    snap->macro_set_count = state->macro_sets_ready ? state->macro_sets.count : 0;
+    memcpy(snap->macro_set_name, state->macro_set_name, sizeof(snap->macro_set_name));
+    snap->macro_index = state->macro_index;
+    snap->macro_pin_hint = state->macro_pin_hint;
+    snap->macro_first = state->macro_index >= MACRO_VISIBLE_LINES ?
+                            state->macro_index - (MACRO_VISIBLE_LINES - 1) :
+                            0;
+    if(state->mode == ModeMacros) {
+        for(uint8_t i = 0; i < MACRO_VISIBLE_LINES; i++) {
+            uint8_t idx = snap->macro_first + i;
+            if(idx >= state->macro_count) break;
+            memcpy(snap->macro_lines[i], state->macros[state->macro_order[idx]], MACRO_MAX_LEN + 1);
+        }
+    }
+
+    /* what each pin binding in the keymap sends, in pin order */
+    memset(snap->pin_rows, 0, sizeof(snap->pin_rows));
+    if(state->mode == ModeRemote) {
+        static const char* const keys[InputKeyMAX] = {"^", "v", ">", "<", "OK", "Bk"};
+        static const char* const gestures[GestureCount] = {"", "2x", "3x", "L", "B+"};
+        for(int key = 0; key < InputKeyMAX; key++) {
+            for(int g = 0; g < GestureCount; g++) {
+                const GestureAction* action = &state->keymap->actions[key][g];
+                if(action->kind != ActionPin || !state->macro_pins[action->count][0]) continue;
+                snprintf(
+                    snap->pin_rows[action->count], sizeof(snap->pin_rows[0]), "%s%s %s",
+                    gestures[g], keys[key], state->macro_pins[action->count]);
+            }
         }
     }
 }
 
+/* Main loop: copy state into the back buffer and make it the front one.
+ * If draw_callback is still reading the back buffer (the previous front),
+ * skip and let the loop retry after RENDER_RETRY_TICKS. */
+static void render_publish(ClaudeRemoteState* state) {
+    RenderState* render = &state->render;
+    unsigned ctrl = atomic_load(&render->ctrl);
+    unsigned back = (ctrl & RENDER_FRONT) ^ 1;
+    if(ctrl & RENDER_BUSY(back)) {
+        render->dirty = true;
+        return;
+    }
+    render_fill(state, &render->buf[back]);
+    /* only this thread flips RENDER_FRONT; the release orders the fill before it */
+    atomic_fetch_xor_explicit(&render->ctrl, RENDER_FRONT, memory_order_acq_rel);
+    render->dirty = false;
+}
+
+/* GUI thread: pin the front buffer for the length of one frame. */
+static const RenderSnapshot* render_acquire(RenderState* render, unsigned* idx) {
+    unsigned ctrl = atomic_load_explicit(&render->ctrl, memory_order_acquire);
+    unsigned front;
+    do {
+        front = ctrl & RENDER_FRONT;
+    } while(!atomic_compare_exchange_weak_explicit(
+        &render->ctrl, &ctrl, ctrl | RENDER_BUSY(front), memory_order_acq_rel,
+        memory_order_acquire));
+    *idx = front;
+    return &render->buf[front];
+}
+
+static void render_release(RenderState* render, unsigned idx) {
+    atomic_fetch_and_explicit(&render->ctrl, ~RENDER_BUSY(idx), memory_order_release);
+}
+
 /* ══════════════════════════════════════════════
  *  Draw callbacks
  * ══════════════════════════════════════════════ */
@@ -1225,17 +4002,37 @@ static void draw_ble_promo(Canvas* canvas) {
 }
 #endif
 
-static void draw_remote(Canvas* canvas, ClaudeRemoteState* state) {
+static void draw_remote(Canvas* canvas, const RenderSnapshot* snap) {
     /* Portrait: 64w x 128h */
     canvas_clear(canvas);
 
-    if(!state->hid_connected) {
+#ifdef HID_TRANSPORT_BLE
+    if(!snap->hid_connected && snap->host_switching) {
+        canvas_set_font(canvas, FontSecondary);
+        canvas_draw_str_aligned(canvas, 32, 30, AlignCenter, AlignCenter, "Switching to");
+        canvas_set_font(canvas, FontPrimary);
+        canvas_draw_str_aligned(canvas, 32, 44, AlignCenter, AlignCenter, snap->host_name);
+        canvas_set_font(canvas, FontSecondary);
+        uint32_t ms = furi_get_tick() - snap->host_switch_tick;
+        char elapsed[16];
+        snprintf(elapsed, sizeof(elapsed), "%lu.%lus", (unsigned long)(ms / 1000),
+                 (unsigned long)(ms % 1000 / 100));
+        canvas_draw_str_aligned(canvas, 32, 64, AlignCenter, AlignCenter, elapsed);
+        canvas_draw_str_aligned(canvas, 32, 110, AlignCenter, AlignCenter, "Hold >: next");
+        return;
+    }
+#endif
+
+    if(!snap->hid_connected) {
         canvas_set_font(canvas, FontPrimary);
         canvas_draw_str_aligned(canvas, 32, 30, AlignCenter, AlignCenter, "Not");
         canvas_draw_str_aligned(canvas, 32, 44, AlignCenter, AlignCenter, "Connected");
         canvas_set_font(canvas, FontSecondary);
 #ifdef HID_TRANSPORT_BLE
-        if(state->use_ble) {
+        if(snap->output == HidOutputBoth) {
+            canvas_draw_str_aligned(canvas, 32, 64, AlignCenter, AlignCenter, "Connect via");
+            canvas_draw_str_aligned(canvas, 32, 74, AlignCenter, AlignCenter, "USB or BT");
+        } else if(snap->output == HidOutputBle) {
             canvas_draw_str_aligned(canvas, 32, 64, AlignCenter, AlignCenter, "Connect via");
             canvas_draw_str_aligned(canvas, 32, 74, AlignCenter, AlignCenter, "Bluetooth");
         } else {
@@ -1246,14 +4043,55 @@ static void draw_remote(Canvas* canvas, ClaudeRemoteState* state) {
         canvas_draw_str_aligned(canvas, 32, 64, AlignCenter, AlignCenter, "Connect via");
         canvas_draw_str_aligned(canvas, 32, 74, AlignCenter, AlignCenter, "USB-C cable");
 #endif
+        /* time since the link dropped (or since launch if it never came up) */
+        uint32_t secs = (furi_get_tick() - snap->link_since) / furi_kernel_get_tick_frequency();
+        char since[16];
+        if(secs < 60) {
+            snprintf(since, sizeof(since), "Down %lus", (unsigned long)secs);
+        } else {
+            snprintf(since, sizeof(since), "Down %lum", (unsigned long)(secs / 60));
+        }
+        canvas_draw_str_aligned(canvas, 32, 94, AlignCenter, AlignCenter, since);
         return;
     }
 
     canvas_set_font(canvas, FontPrimary);
+#ifdef HID_TRANSPORT_BLE
+    if(snap->host_ready_tick && furi_get_tick() - snap->host_ready_tick < HOST_READY_SHOW_TICKS) {
+        /* time-to-ready of the last host switch */
+        char ready[20];
+        snprintf(ready, sizeof(ready), "Ready %lu.%lus",
+                 (unsigned long)(snap->host_ready_ms / 1000),
+                 (unsigned long)(snap->host_ready_ms % 1000 / 100));
+        canvas_set_font(canvas, FontSecondary);
+        canvas_draw_str_aligned(canvas, 32, 10, AlignCenter, AlignCenter, ready);
+        canvas_set_font(canvas, FontPrimary);
+    } else {
+        canvas_draw_str_aligned(canvas, 32, 10, AlignCenter, AlignCenter, "Claupper");
+    }
+#else
     canvas_draw_str_aligned(canvas, 32, 10, AlignCenter, AlignCenter, "Claupper");
+#endif
 #ifdef HID_TRANSPORT_BLE
-    canvas_draw_str_aligned(canvas, 32, 22, AlignCenter, AlignCenter,
-        state->use_ble ? "BT" : "USB");
+    if(snap->output == HidOutputBoth) {
+        /* per-link indicator: filled = connected, outline = waiting */
+        canvas_set_font(canvas, FontSecondary);
+        static const char* const names[LinkCount] = {"USB", "BT"};
+        for(int i = 0; i < LinkCount; i++) {
+            int x = 4 + i * 30;
+            if(snap->link_up[i]) {
+                canvas_draw_rbox(canvas, x, 16, 26, 11, 2);
+                canvas_set_color(canvas, ColorWhite);
+            } else {
+                canvas_draw_rframe(canvas, x, 16, 26, 11, 2);
+            }
+            canvas_draw_str_aligned(canvas, x + 13, 22, AlignCenter, AlignCenter, names[i]);
+            canvas_set_color(canvas, ColorBlack);
+        }
+    } else {
+        canvas_draw_str_aligned(canvas, 32, 22, AlignCenter, AlignCenter,
+            snap->output == HidOutputBle ? snap->host_name : "USB");
+    }
 #else
     canvas_draw_str_aligned(canvas, 32, 22, AlignCenter, AlignCenter, "USB");
 #endif
@@ -1287,36 +4125,215 @@ static void draw_remote(Canvas* canvas, ClaudeRemoteState* state) {
     canvas_draw_str_aligned(canvas, 32, 69, AlignCenter, AlignCenter, "OK");
     canvas_set_color(canvas, ColorBlack);
 
-    /* Right: "3" + "?" */
-    canvas_set_font(canvas, FontPrimary);
-    canvas_draw_str_aligned(canvas, 52, 59, AlignCenter, AlignCenter, "3");
+    /* Right: "3" + "?" */
+    canvas_set_font(canvas, FontPrimary);
+    canvas_draw_str_aligned(canvas, 52, 59, AlignCenter, AlignCenter, "3");
+    canvas_set_font(canvas, FontPrimary);
+    canvas_draw_str_aligned(canvas, 52, 69, AlignCenter, AlignCenter, "?");
+
+    /* Down: Mic icon (Dictation) */
+    canvas_draw_rframe(canvas, 29, 78, 6, 7, 2);
+    canvas_draw_line(canvas, 27, 82, 27, 85);
+    canvas_draw_line(canvas, 27, 85, 37, 85);
+    canvas_draw_line(canvas, 37, 82, 37, 85);
+    canvas_draw_line(canvas, 32, 85, 32, 89);
+    canvas_draw_line(canvas, 29, 89, 35, 89);
+    canvas_draw_line(canvas, 32, 95, 29, 92);
+    canvas_draw_line(canvas, 32, 95, 35, 92);
+
+    /* Pinned macros under the d-pad, clipped at the screen edge */
+    canvas_set_font(canvas, FontSecondary);
+    int pin_y = 107;
+    for(uint8_t i = 0; i < MACRO_PIN_MAX; i++) {
+        if(!snap->pin_rows[i][0]) continue;
+        canvas_draw_str(canvas, 1, pin_y, snap->pin_rows[i]);
+        pin_y += 10;
+    }
+
+    /* Flash overlay: inverted bar showing what was sent */
+    if(snap->flash_label[0] &&
+       (furi_get_tick() - snap->flash_tick) < FLASH_DURATION_TICKS) {
+        canvas_draw_rbox(canvas, 0, 100, 64, 28, 3);
+        canvas_set_color(canvas, ColorWhite);
+        canvas_set_font(canvas, FontPrimary);
+        canvas_draw_str_aligned(canvas, 32, 114, AlignCenter, AlignCenter, snap->flash_label);
+        canvas_set_color(canvas, ColorBlack);
+    }
+}
+
+/* ── Stats page (portrait 64x128, hidden in Remote mode) ── */
+
+static void draw_stats_hist(Canvas* canvas, int y, const char* name, const LatencyHist* hist) {
+    char line[24];
+    snprintf(line, sizeof(line), "%s %lu/%lu", name,
+             (unsigned long)stats_hist_avg(hist), (unsigned long)hist->max_ms);
+    canvas_draw_str(canvas, 2, y, line);
+
+    /* one 7px bar per bucket, scaled to the fullest bucket */
+    uint32_t peak = 0;
+    for(uint8_t b = 0; b < STATS_BUCKET_COUNT; b++) {
+        if(hist->buckets[b] > peak) peak = hist->buckets[b];
+    }
+    int base = y + 18;
+    canvas_draw_line(canvas, 0, base, 63, base);
+    for(uint8_t b = 0; b < STATS_BUCKET_COUNT; b++) {
+        if(hist->buckets[b] == 0) continue;
+        int h = (int)((hist->buckets[b] * 15 + peak - 1) / peak);
+        canvas_draw_box(canvas, b * 8, base - h, 7, h);
+    }
+}
+
+#ifdef PROFILE_CYCLES
+static void draw_profile(Canvas* canvas, const RenderSnapshot* snap) {
+    canvas_clear(canvas);
+
+    canvas_set_font(canvas, FontPrimary);
+    canvas_draw_str_aligned(canvas, 32, 8, AlignCenter, AlignCenter, "Profile");
+    canvas_draw_line(canvas, 0, 14, 64, 14);
+
+    /* min/avg/max per region, in microseconds */
+    canvas_set_font(canvas, FontSecondary);
+    uint32_t cyc_per_us = furi_hal_cortex_instructions_per_microsecond();
+    for(int r = 0; r < ProfRegionCount; r++) {
+        const ProfStat* stat = &snap->prof[r];
+        int y = 24 + r * 20;
+        canvas_draw_str(canvas, 2, y, prof_region_names[r]);
+        char line[24];
+        if(stat->count == 0) {
+            snprintf(line, sizeof(line), "-");
+        } else {
+            snprintf(line, sizeof(line), "%lu/%lu/%lu",
+                     (unsigned long)(stat->min / cyc_per_us),
+                     (unsigned long)(stat->total / stat->count / cyc_per_us),
+                     (unsigned long)(stat->max / cyc_per_us));
+        }
+        canvas_draw_str_aligned(canvas, 62, y + 9, AlignRight, AlignBottom, line);
+    }
+}
+#endif
+
+#ifdef DIAG_MEMORY
+static void draw_diag_memory(Canvas* canvas, const RenderSnapshot* snap) {
+    const DiagCounts* diag = &snap->diag;
+    canvas_clear(canvas);
+
+    canvas_set_font(canvas, FontPrimary);
+    canvas_draw_str_aligned(canvas, 32, 8, AlignCenter, AlignCenter, "Memory");
+    canvas_draw_line(canvas, 0, 14, 64, 14);
+
+    canvas_set_font(canvas, FontSecondary);
+    const char* labels[7] = {"Main stk", "Draw stk", "GUI free", "Heap app", "Heap free", "Heap min",
+                             "Screens"};
+    uint32_t values[7] = {
+        diag->main_stack_used,
+        diag->draw_stack_max,
+        diag->gui_stack_free,
+        diag->heap_app,
+        diag->heap_free,
+        diag->heap_min_free,
+        __builtin_popcount(diag->screens_seen),
+    };
+    for(int i = 0; i < 7; i++) {
+        int y = 24 + i * 11;
+        char val[16];
+        if(i == 6) {
+            snprintf(val, sizeof(val), "%lu/%d", (unsigned long)values[i], DiagScreenCount);
+        } else {
+            snprintf(val, sizeof(val), "%lu", (unsigned long)values[i]);
+        }
+        canvas_draw_str(canvas, 2, y, labels[i]);
+        canvas_draw_str_aligned(canvas, 62, y, AlignRight, AlignBottom, val);
+    }
+}
+#endif
+
+static void draw_rtt(Canvas* canvas, const RenderSnapshot* snap) {
+    canvas_clear(canvas);
+
+    canvas_set_font(canvas, FontPrimary);
+    canvas_draw_str_aligned(canvas, 32, 8, AlignCenter, AlignCenter, "RTT ms");
+    canvas_draw_line(canvas, 0, 14, 64, 14);
+
+    /* avg/max over USB */
+    canvas_set_font(canvas, FontSecondary);
+    const LatencyHist* hist = &snap->stats.rtt;
+    if(hist->count) {
+        char val[24];
+        snprintf(val, sizeof(val), "%lu/%lu", (unsigned long)stats_hist_avg(hist),
+                 (unsigned long)hist->max_ms);
+        canvas_draw_str(canvas, 2, 24, "USB");
+        canvas_draw_str_aligned(canvas, 62, 34, AlignRight, AlignBottom, val);
+    } else {
+        canvas_draw_str_aligned(canvas, 32, 40, AlignCenter, AlignCenter, "No probes yet");
+    }
+
+    /* current hold → suggested hold */
+    canvas_draw_line(canvas, 0, 90, 64, 90);
+    uint16_t hold = rtt_suggest_hold(hist);
+    if(hold) {
+        char val[24];
+        snprintf(val, sizeof(val), "USB %u>%u", snap->hold_ms[RTT_LINK], hold);
+        canvas_draw_str(canvas, 2, 99, val);
+    }
+
+    if(snap->rtt_phase != RttIdle) {
+        char progress[16];
+        snprintf(progress, sizeof(progress), "Probe %u/%u", snap->rtt_toggles, RTT_PROBES * 2);
+        canvas_draw_str_aligned(canvas, 32, 118, AlignCenter, AlignBottom, progress);
+        canvas_draw_str_aligned(canvas, 32, 127, AlignCenter, AlignBottom, "Back:Stop");
+    } else {
+        canvas_draw_str_aligned(canvas, 32, 118, AlignCenter, AlignBottom, "OK:Probe");
+        canvas_draw_str_aligned(canvas, 32, 127, AlignCenter, AlignBottom, "Hold OK:Apply");
+    }
+}
+
+static void draw_stats(Canvas* canvas, const RenderSnapshot* snap) {
+    if(snap->stats_page == StatsPageRtt) {
+        draw_rtt(canvas, snap);
+        return;
+    }
+#ifdef PROFILE_CYCLES
+    if(snap->stats_page == StatsPageProfile) {
+        draw_profile(canvas, snap);
+        return;
+    }
+#endif
+#ifdef DIAG_MEMORY
+    if(snap->stats_page == StatsPageMemory) {
+        draw_diag_memory(canvas, snap);
+        return;
+    }
+#endif
+    const AppStats* stats = &snap->stats;
+    canvas_clear(canvas);
+
     canvas_set_font(canvas, FontPrimary);
-    canvas_draw_str_aligned(canvas, 52, 69, AlignCenter, AlignCenter, "?");
-
-    /* Down: Mic icon (Dictation) */
-    canvas_draw_rframe(canvas, 29, 78, 6, 7, 2);
-    canvas_draw_line(canvas, 27, 82, 27, 85);
-    canvas_draw_line(canvas, 27, 85, 37, 85);
-    canvas_draw_line(canvas, 37, 82, 37, 85);
-    canvas_draw_line(canvas, 32, 85, 32, 89);
-    canvas_draw_line(canvas, 29, 89, 35, 89);
-    canvas_draw_line(canvas, 32, 95, 29, 92);
-    canvas_draw_line(canvas, 32, 95, 35, 92);
+    canvas_draw_str_aligned(canvas, 32, 8, AlignCenter, AlignCenter, "Stats");
+    canvas_draw_line(canvas, 0, 14, 64, 14);
 
-    /* Flash overlay: inverted bar showing what was sent */
-    if(state->flash_label &&
-       (furi_get_tick() - state->flash_tick) < FLASH_DURATION_TICKS) {
-        canvas_draw_rbox(canvas, 0, 100, 64, 28, 3);
-        canvas_set_color(canvas, ColorWhite);
-        canvas_set_font(canvas, FontPrimary);
-        canvas_draw_str_aligned(canvas, 32, 114, AlignCenter, AlignCenter, state->flash_label);
-        canvas_set_color(canvas, ColorBlack);
+    canvas_set_font(canvas, FontSecondary);
+    const char* labels[5] = {"Press", "Report", "Macro", "Bytes", "Drops"};
+    const uint32_t values[5] = {
+        stats->presses, stats->reports, stats->macros, stats->bytes, stats->drops};
+    for(int i = 0; i < 5; i++) {
+        int y = 22 + i * 8;
+        char val[12];
+        snprintf(val, sizeof(val), "%lu", (unsigned long)values[i]);
+        canvas_draw_str(canvas, 2, y, labels[i]);
+        canvas_draw_str_aligned(canvas, 62, y, AlignRight, AlignBottom, val);
     }
+    canvas_draw_line(canvas, 0, 56, 64, 56);
+
+    /* avg/max in ms, histogram buckets <=10,25,50,100,200,400,800,>800 */
+    draw_stats_hist(canvas, 65, "P>S", &stats->press_to_send);
+    draw_stats_hist(canvas, 95, "Send", &stats->send_time);
+
+    canvas_draw_str_aligned(canvas, 32, 127, AlignCenter, AlignBottom, "Hold OK:Reset");
 }
 
 /* ── Manual: Category list (landscape 128x64) ── */
 
-static void draw_manual_categories(Canvas* canvas, ClaudeRemoteState* state) {
+static void draw_manual_categories(Canvas* canvas, const RenderSnapshot* snap) {
     canvas_clear(canvas);
 
     canvas_set_font(canvas, FontPrimary);
@@ -1327,14 +4344,14 @@ static void draw_manual_categories(Canvas* canvas, ClaudeRemoteState* state) {
 
     /* show up to 3 items at a time */
     uint8_t first_visible = 0;
-    if(state->cat_index > 2) first_visible = state->cat_index - 2;
+    if(snap->cat_index > 2) first_visible = snap->cat_index - 2;
 
     for(int i = 0; i < 3; i++) {
         uint8_t idx = first_visible + i;
         if(idx >= MENU_ITEM_COUNT) break;
 
         int y = 24 + i * 12;
-        bool selected = (idx == state->cat_index);
+        bool selected = (idx == snap->cat_index);
 
         if(selected) {
             canvas_draw_box(canvas, 0, y - 9, 128, 12);
@@ -1346,11 +4363,16 @@ static void draw_manual_categories(Canvas* canvas, ClaudeRemoteState* state) {
             canvas_draw_frame(canvas, 4, y - 6, 8, 5);
             canvas_draw_line(canvas, 4, y - 7, 7, y - 7);
             canvas_draw_str(canvas, 16, y, categories[idx].name);
-        } else {
+        } else if(idx == MENU_QUIZ) {
             /* quiz entry — star icon */
             canvas_draw_line(canvas, 8, y - 7, 8, y - 2);
             canvas_draw_line(canvas, 5, y - 5, 11, y - 5);
             canvas_draw_str(canvas, 16, y, "Quiz Mode");
+        } else {
+            /* search entry — magnifier icon */
+            canvas_draw_circle(canvas, 7, y - 5, 2);
+            canvas_draw_line(canvas, 9, y - 3, 11, y - 1);
+            canvas_draw_str(canvas, 16, y, "Search");
         }
 
         if(selected) {
@@ -1371,10 +4393,10 @@ static void draw_manual_categories(Canvas* canvas, ClaudeRemoteState* state) {
 
 /* ── Manual: Section list (landscape 128x64) ── */
 
-static void draw_manual_sections(Canvas* canvas, ClaudeRemoteState* state) {
+static void draw_manual_sections(Canvas* canvas, const RenderSnapshot* snap) {
     canvas_clear(canvas);
 
-    const ManualCategory* cat = &categories[state->cat_index];
+    const ManualCategory* cat = &categories[snap->cat_index];
 
     canvas_set_font(canvas, FontPrimary);
     char header[32];
@@ -1385,14 +4407,14 @@ static void draw_manual_sections(Canvas* canvas, ClaudeRemoteState* state) {
     canvas_set_font(canvas, FontSecondary);
 
     uint8_t first_visible = 0;
-    if(state->section_index > 2) first_visible = state->section_index - 2;
+    if(snap->section_index > 2) first_visible = snap->section_index - 2;
 
     for(int i = 0; i < 3; i++) {
         uint8_t idx = first_visible + i;
         if(idx >= cat->section_count) break;
 
         int y = 24 + i * 12;
-        bool selected = (idx == state->section_index);
+        bool selected = (idx == snap->section_index);
 
         if(selected) {
             canvas_draw_box(canvas, 0, y - 9, 128, 12);
@@ -1418,53 +4440,45 @@ static void draw_manual_sections(Canvas* canvas, ClaudeRemoteState* state) {
 
 /* ── Manual: Content reader (landscape 128x64) ── */
 
-static void draw_manual_read(Canvas* canvas, ClaudeRemoteState* state) {
+static void draw_manual_read(Canvas* canvas, const RenderSnapshot* snap) {
     canvas_clear(canvas);
 
-    const ManualCategory* cat = &categories[state->cat_index];
-    const ManualSection* sec = &cat->sections[state->section_index];
+    const ManualCategory* cat = &categories[snap->cat_index];
+    const ManualSection* sec = &cat->sections[snap->section_index];
 
     /* title bar */
     canvas_set_font(canvas, FontPrimary);
     char header[48];
     snprintf(
         header, sizeof(header), "%d/%d %s",
-        state->section_index + 1, cat->section_count, sec->title);
+        snap->section_index + 1, cat->section_count, sec->title);
     canvas_draw_str(canvas, 2, 10, header);
     canvas_draw_line(canvas, 0, 13, 128, 13);
 
-    /* scrollable body */
-    canvas_set_font(canvas, FontSecondary);
-
-    const char* p = sec->content;
-    int current_line = 0;
-
-    /* skip lines before scroll offset */
-    while(*p && current_line < state->scroll_offset) {
-        if(*p == '\n') current_line++;
-        p++;
+    /* scrollable body; lines were wrapped to the screen at build time */
+    const ReadLayout* layout = &read_layouts[snap->manual_dense];
+    if(snap->manual_dense) {
+        canvas_set_custom_u8g2_font(canvas, u8g2_font_4x6_tr);
+    } else {
+        canvas_set_font(canvas, FontSecondary);
     }
-
-    /* render visible lines */
-    int y = 24;
-    while(*p && y < 62) {
-        char line_buf[32];
-        int i = 0;
-        while(*p && *p != '\n' && i < 30) {
-            line_buf[i++] = *p++;
-        }
-        line_buf[i] = '\0';
-        if(*p == '\n') p++;
-
-        canvas_draw_str(canvas, 2, y, line_buf);
-        y += 10;
+    uint8_t id = manual_section_id(snap->cat_index, snap->section_index);
+    uint16_t first = layout->first[id] + snap->scroll_offset;
+    uint16_t end = layout->first[id + 1];
+    for(uint16_t i = 0; i < layout->visible && first + i < end; i++) {
+        char line_buf[48];
+        layout_line_text(
+            sec->content, &layout->lines[first + i], layout->skip[first + i], line_buf,
+            sizeof(line_buf));
+        canvas_draw_str(canvas, 2, layout->top + i * layout->pitch, line_buf);
     }
 
     /* scroll indicators */
-    if(state->scroll_offset > 0) {
+    canvas_set_font(canvas, FontSecondary);
+    if(snap->scroll_offset > 0) {
         canvas_draw_str_aligned(canvas, 124, 17, AlignRight, AlignTop, "^");
     }
-    if(*p) {
+    if(first + layout->visible < end) {
         canvas_draw_str_aligned(canvas, 124, 62, AlignRight, AlignBottom, "v");
     }
 
@@ -1472,32 +4486,88 @@ static void draw_manual_read(Canvas* canvas, ClaudeRemoteState* state) {
     canvas_draw_str_aligned(canvas, 64, 62, AlignCenter, AlignBottom, "<  >");
 }
 
+/* ── Manual: Search (landscape 128x64) ── */
+
+static void draw_manual_search(Canvas* canvas, const RenderSnapshot* snap) {
+    canvas_clear(canvas);
+
+    canvas_set_font(canvas, FontPrimary);
+    char header[SEARCH_QUERY_MAX + 8];
+    snprintf(header, sizeof(header), "Find: %s_", snap->search_query);
+    canvas_draw_str(canvas, 2, 10, header);
+    canvas_draw_line(canvas, 0, 13, 128, 13);
+
+    /* picker: nine characters around the current one */
+    canvas_set_font(canvas, FontSecondary);
+    int count = sizeof(search_alphabet) - 1;
+    for(int i = -4; i <= 4; i++) {
+        char c[2] = {search_alphabet[(snap->search_char + i + count) % count], '\0'};
+        int x = 64 + i * 12;
+        if(i == 0 && !snap->search_in_hits) {
+            canvas_draw_box(canvas, x - 5, 15, 11, 10);
+            canvas_set_color(canvas, ColorWhite);
+        }
+        canvas_draw_str_aligned(canvas, x, 20, AlignCenter, AlignCenter, c);
+        canvas_set_color(canvas, ColorBlack);
+    }
+    if(!snap->search_in_hits) canvas_draw_frame(canvas, 59, 15, 11, 10);
+
+    if(snap->search_query[0] == '\0') {
+        canvas_draw_str_aligned(canvas, 64, 40, AlignCenter, AlignCenter, "<>:Letter  OK:Add");
+    } else if(snap->search_hit_count == 0) {
+        canvas_draw_str_aligned(canvas, 64, 40, AlignCenter, AlignCenter, "No matches");
+    } else {
+        uint8_t first = 0;
+        if(snap->search_hit_index >= SEARCH_VISIBLE) first = snap->search_hit_index - (SEARCH_VISIBLE - 1);
+        for(uint8_t i = 0; i < SEARCH_VISIBLE && first + i < snap->search_hit_count; i++) {
+            uint8_t idx = first + i;
+            int y = 35 + i * 10;
+            bool selected = snap->search_in_hits && idx == snap->search_hit_index;
+            if(selected) {
+                canvas_draw_box(canvas, 0, y - 8, 128, 10);
+                canvas_set_color(canvas, ColorWhite);
+            }
+            char line[32];
+            search_hit_text(snap->search_hits[idx], line, sizeof(line));
+            canvas_draw_str(canvas, 2, y, line);
+            canvas_set_color(canvas, ColorBlack);
+        }
+    }
+
+    /* footer: where the selected hit is, or how to use the picker */
+    char footer[32];
+    if(snap->search_in_hits) {
+        uint16_t hit = snap->search_hits[snap->search_hit_index];
+        uint8_t cat, section;
+        snprintf(
+            footer, sizeof(footer), "%d/%d %s", snap->search_hit_index + 1, snap->search_hit_count,
+            search_doc_section(hit >> 8, &cat, &section) ? categories[cat].sections[section].title :
+                                                           "Quiz");
+    } else if(snap->search_hit_count > 0) {
+        snprintf(footer, sizeof(footer), "%d hits  v:List  Bk:Del", snap->search_hit_count);
+    } else {
+        snprintf(footer, sizeof(footer), "Bk:Del");
+    }
+    canvas_draw_str_aligned(canvas, 64, 63, AlignCenter, AlignBottom, footer);
+}
+
 /* ── Manual: Quiz mode (landscape 128x64) ── */
 
 /* ── Quiz: draw helpers ── */
 
-static void draw_quiz_question(Canvas* canvas, const char* desc) {
+/* the first pre-wrapped lines; the options fill the rest */
+static void draw_quiz_question(Canvas* canvas, const RenderSnapshot* snap) {
     canvas_set_font(canvas, FontSecondary);
-    const char* p = desc;
-    int y = 24;
-    while(*p && y < 38) {
-        char line_buf[32];
-        int i = 0;
-        while(*p && *p != '\n' && i < 30) {
-            line_buf[i++] = *p++;
-        }
-        line_buf[i] = '\0';
-        if(*p == '\n') p++;
-        canvas_draw_str(canvas, 4, y, line_buf);
-        y += 10;
+    for(uint8_t i = 0; i < QUIZ_QUESTION_LINES; i++) {
+        canvas_draw_str(canvas, 4, 24 + i * 10, snap->quiz_question[i]);
     }
 }
 
-static void draw_quiz_multichoice(Canvas* canvas, ClaudeRemoteState* state, const QuizCard* card) {
-    draw_quiz_question(canvas, card->description);
+static void draw_quiz_multichoice(Canvas* canvas, const RenderSnapshot* snap) {
+    draw_quiz_question(canvas, snap);
 
-    if(state->quiz_answered) {
-        bool was_correct = (state->quiz_selected == card->correct_option);
+    if(snap->quiz_answered) {
+        bool was_correct = (snap->quiz_selected == snap->quiz_correct_option);
         const char* result_str = was_correct ? "CORRECT!" : "WRONG!";
 
         /* Window frame */
@@ -1525,18 +4595,17 @@ static void draw_quiz_multichoice(Canvas* canvas, ClaudeRemoteState* state, cons
 
         /* Answer text */
         canvas_set_font(canvas, FontSecondary);
-        canvas_draw_str_aligned(canvas, 64, 40, AlignCenter, AlignCenter, card->command);
+        canvas_draw_str_aligned(canvas, 64, 40, AlignCenter, AlignCenter, snap->quiz_answer);
 
         /* Footer */
         canvas_draw_str_aligned(canvas, 64, 53, AlignCenter, AlignCenter, "OK:Next");
     } else {
-        const char* opts[3] = {card->option_a, card->option_b, card->option_c};
         const char* labels[3] = {"<", "^", ">"};
 
         canvas_set_font(canvas, FontSecondary);
         for(int i = 0; i < 3; i++) {
             int oy = 44 + i * 8;
-            bool selected = (state->quiz_selected == i);
+            bool selected = (snap->quiz_selected == i);
 
             if(selected) {
                 canvas_draw_box(canvas, 0, oy - 7, 128, 9);
@@ -1544,7 +4613,7 @@ static void draw_quiz_multichoice(Canvas* canvas, ClaudeRemoteState* state, cons
             }
 
             char opt_buf[32];
-            snprintf(opt_buf, sizeof(opt_buf), "%s %s", labels[i], opts[i]);
+            snprintf(opt_buf, sizeof(opt_buf), "%s %s", labels[i], snap->quiz_options[i]);
             canvas_draw_str(canvas, 2, oy, opt_buf);
 
             if(selected) {
@@ -1554,13 +4623,19 @@ static void draw_quiz_multichoice(Canvas* canvas, ClaudeRemoteState* state, cons
     }
 }
 
-static void draw_manual_quiz(Canvas* canvas, ClaudeRemoteState* state) {
+static void draw_manual_quiz(Canvas* canvas, const RenderSnapshot* snap) {
     canvas_clear(canvas);
 
     /* difficulty picker */
-    if(state->quiz_selecting) {
+    if(snap->quiz_selecting) {
         canvas_set_font(canvas, FontPrimary);
-        canvas_draw_str_aligned(canvas, 64, 10, AlignCenter, AlignCenter, "Quiz Mode");
+        if(snap->quiz_bank_count) {
+            char title[24];
+            snprintf(title, sizeof(title), "Quiz: %u cards", snap->quiz_bank_count);
+            canvas_draw_str_aligned(canvas, 64, 10, AlignCenter, AlignCenter, title);
+        } else {
+            canvas_draw_str_aligned(canvas, 64, 10, AlignCenter, AlignCenter, "Quiz Mode");
+        }
         canvas_draw_line(canvas, 0, 18, 128, 18);
 
         /* Mac-style modal */
@@ -1593,7 +4668,7 @@ static void draw_manual_quiz(Canvas* canvas, ClaudeRemoteState* state) {
     }
 
     /* completion screen */
-    if(state->quiz_index >= state->quiz_count) {
+    if(snap->quiz_index >= snap->quiz_count) {
         canvas_set_font(canvas, FontPrimary);
         canvas_draw_str_aligned(canvas, 64, 10, AlignCenter, AlignCenter, "Quiz Complete!");
         canvas_draw_line(canvas, 0, 18, 128, 18);
@@ -1601,11 +4676,11 @@ static void draw_manual_quiz(Canvas* canvas, ClaudeRemoteState* state) {
         canvas_set_font(canvas, FontSecondary);
         char score_buf[32];
         snprintf(score_buf, sizeof(score_buf), "Score: %d / %d",
-                 state->quiz_correct, state->quiz_total);
+                 snap->quiz_correct, snap->quiz_total);
         canvas_draw_str_aligned(canvas, 64, 30, AlignCenter, AlignCenter, score_buf);
 
-        if(state->quiz_total > 0) {
-            int pct = (state->quiz_correct * 100) / state->quiz_total;
+        if(snap->quiz_total > 0) {
+            int pct = (snap->quiz_correct * 100) / snap->quiz_total;
             char pct_buf[16];
             snprintf(pct_buf, sizeof(pct_buf), "%d%% correct", pct);
             canvas_draw_str_aligned(canvas, 64, 40, AlignCenter, AlignCenter, pct_buf);
@@ -1613,7 +4688,7 @@ static void draw_manual_quiz(Canvas* canvas, ClaudeRemoteState* state) {
 
         char streak_buf[24];
         snprintf(streak_buf, sizeof(streak_buf), "Best streak: %d",
-                 state->quiz_best_streak);
+                 snap->quiz_best_streak);
         canvas_draw_str_aligned(canvas, 64, 50, AlignCenter, AlignCenter, streak_buf);
 
         canvas_draw_rframe(canvas, 16, 22, 96, 34, 3);
@@ -1622,38 +4697,39 @@ static void draw_manual_quiz(Canvas* canvas, ClaudeRemoteState* state) {
         return;
     }
 
-    uint8_t real_index = state->quiz_order[state->quiz_index];
-    const QuizCard* card = &quiz_cards[real_index];
-
     /* header */
     canvas_set_font(canvas, FontPrimary);
     char header[32];
     snprintf(header, sizeof(header), "Quiz %d/%d",
-             state->quiz_index + 1, state->quiz_count);
+             snap->quiz_index + 1, snap->quiz_count);
     canvas_draw_str(canvas, 2, 10, header);
 
     /* score + streak */
     canvas_set_font(canvas, FontSecondary);
-    if(state->quiz_total > 0 || state->quiz_streak > 0) {
+    if(snap->quiz_total > 0 || snap->quiz_streak > 0) {
         char score[20];
-        if(state->quiz_streak >= 2) {
+        if(snap->quiz_streak >= 2) {
             snprintf(score, sizeof(score), "%d/%d %dx",
-                     state->quiz_correct, state->quiz_total, state->quiz_streak);
+                     snap->quiz_correct, snap->quiz_total, snap->quiz_streak);
         } else {
             snprintf(score, sizeof(score), "%d/%d",
-                     state->quiz_correct, state->quiz_total);
+                     snap->quiz_correct, snap->quiz_total);
         }
         canvas_draw_str_aligned(canvas, 124, 10, AlignRight, AlignCenter, score);
     }
 
     canvas_draw_line(canvas, 0, 13, 128, 13);
 
-    draw_quiz_multichoice(canvas, state, card);
+    if(!snap->quiz_ready) {
+        canvas_draw_str_aligned(canvas, 64, 38, AlignCenter, AlignCenter, "Loading...");
+        return;
+    }
+    draw_quiz_multichoice(canvas, snap);
 }
 
 /* ── Settings screen (landscape 128x64) ── */
 
-static void draw_settings(Canvas* canvas, ClaudeRemoteState* state) {
+static void draw_settings(Canvas* canvas, const RenderSnapshot* snap) {
     canvas_clear(canvas);
 
     canvas_set_font(canvas, FontPrimary);
@@ -1662,11 +4738,17 @@ static void draw_settings(Canvas* canvas, ClaudeRemoteState* state) {
 
     canvas_set_font(canvas, FontSecondary);
 
-    const char* labels[SETTINGS_COUNT] = {"Haptics", "LED", "OS"};
+    const char* labels[SETTINGS_COUNT] = {"Haptics", "LED", "OS", "Scroll", "Taps", "Macros"};
+
+    char tap_str[12];
+    uint8_t first_visible = 0;
+    if(snap->settings_index >= SETTINGS_VISIBLE) first_visible = snap->settings_index - (SETTINGS_VISIBLE - 1);
 
-    for(int i = 0; i < SETTINGS_COUNT; i++) {
-        int y = 26 + i * 13;
-        bool selected = (i == state->settings_index);
+    for(int row = 0; row < SETTINGS_VISIBLE; row++) {
+        int i = first_visible + row;
+        if(i >= SETTINGS_COUNT) break;
+        int y = 26 + row * 13;
+        bool selected = (i == snap->settings_index);
 
         if(selected) {
             canvas_draw_str(canvas, 4, y, ">");
@@ -1675,19 +4757,31 @@ static void draw_settings(Canvas* canvas, ClaudeRemoteState* state) {
         canvas_draw_str(canvas, 14, y, labels[i]);
 
         const char* val_str;
-        if(i == 0) val_str = state->haptics_enabled ? "[ON]" : "[OFF]";
-        else if(i == 1) val_str = state->led_enabled ? "[ON]" : "[OFF]";
-        else val_str = state->os_mode == 1 ? "[Win]" : state->os_mode == 2 ? "[Linux]" : "[Mac]";
+        if(i == 0) val_str = snap->haptics_enabled ? "[ON]" : "[OFF]";
+        else if(i == 1) val_str = snap->led_enabled ? "[ON]" : "[OFF]";
+        else if(i == 2) val_str = snap->os_mode == 1 ? "[Win]" : snap->os_mode == 2 ? "[Linux]" : "[Mac]";
+        else if(i == 3) val_str = snap->scroll_mode == ScrollModeWheel ? "[Wheel]" : "[Page]";
+        else if(i == 4) {
+            snprintf(tap_str, sizeof(tap_str), "[%ums]", snap->tap_ms);
+            val_str = tap_str;
+        } else val_str = snap->macro_sort == MacroSortFile ? "[File]" : "[Used]";
         canvas_draw_str_aligned(canvas, 110, y, AlignRight, AlignBottom, val_str);
     }
 
+    if(first_visible > 0) {
+        canvas_draw_str_aligned(canvas, 124, 17, AlignRight, AlignTop, "^");
+    }
+    if(first_visible + SETTINGS_VISIBLE < SETTINGS_COUNT) {
+        canvas_draw_str_aligned(canvas, 124, 50, AlignRight, AlignBottom, "v");
+    }
+
     canvas_draw_line(canvas, 0, 54, 128, 54);
     canvas_draw_str_aligned(canvas, 64, 62, AlignCenter, AlignBottom, "OK:Toggle  Bk:Save");
 }
 
 /* ── Macros screen (landscape 128x64) ── */
 
-static void draw_macros(Canvas* canvas, ClaudeRemoteState* state) {
+static void draw_macros(Canvas* canvas, const RenderSnapshot* snap) {
     canvas_clear(canvas);
 
     canvas_set_font(canvas, FontPrimary);
@@ -1696,20 +4790,27 @@ static void draw_macros(Canvas* canvas, ClaudeRemoteState* state) {
 
     canvas_set_font(canvas, FontSecondary);
 
-    if(state->macro_count == 0) {
+    if(snap->macro_set_count > 1) {
+        char set_str[MACRO_SET_NAME_LEN + 5];
+        snprintf(set_str, sizeof(set_str), "< %s >", snap->macro_set_name);
+        canvas_draw_str_aligned(canvas, 126, 10, AlignRight, AlignBottom, set_str);
+    }
+
+    if(snap->macros_loading) {
+        canvas_draw_str_aligned(canvas, 64, 36, AlignCenter, AlignCenter, "Loading...");
+    } else if(snap->macro_count == 0) {
         canvas_draw_str_aligned(canvas, 64, 30, AlignCenter, AlignCenter, "No macros found");
-        canvas_draw_str_aligned(canvas, 64, 42, AlignCenter, AlignCenter, "Add lines to:");
-        canvas_draw_str(canvas, 4, 52, MACROS_PATH);
+        canvas_draw_str_aligned(canvas, 64, 42, AlignCenter, AlignCenter, "Add .txt files to:");
+        canvas_draw_str(canvas, 4, 52, MACROS_DIR);
     } else {
-        uint8_t first_visible = 0;
-        if(state->macro_index > 2) first_visible = state->macro_index - 2;
+        uint8_t first_visible = snap->macro_first;
 
-        for(int i = 0; i < 3; i++) {
+        for(int i = 0; i < MACRO_VISIBLE_LINES; i++) {
             uint8_t idx = first_visible + i;
-            if(idx >= state->macro_count) break;
+            if(idx >= snap->macro_count) break;
 
             int y = 24 + i * 12;
-            bool selected = (idx == state->macro_index);
+            bool selected = (idx == snap->macro_index);
 
             if(selected) {
                 canvas_draw_box(canvas, 0, y - 9, 128, 12);
@@ -1717,7 +4818,7 @@ static void draw_macros(Canvas* canvas, ClaudeRemoteState* state) {
             }
 
             char display[MACRO_MAX_LEN + 8];
-            snprintf(display, sizeof(display), "%d. %s", idx + 1, state->macros[idx]);
+            snprintf(display, sizeof(display), "%d. %s", idx + 1, snap->macro_lines[i]);
             canvas_draw_str(canvas, 4, y, display);
 
             if(selected) {
@@ -1728,22 +4829,31 @@ static void draw_macros(Canvas* canvas, ClaudeRemoteState* state) {
         if(first_visible > 0) {
             canvas_draw_str_aligned(canvas, 124, 17, AlignRight, AlignTop, "^");
         }
-        if(first_visible + 3 < state->macro_count) {
+        if(first_visible + MACRO_VISIBLE_LINES < snap->macro_count) {
             canvas_draw_str_aligned(canvas, 124, 50, AlignRight, AlignBottom, "v");
         }
     }
 
     canvas_draw_line(canvas, 0, 54, 128, 54);
-    canvas_draw_str_aligned(canvas, 64, 62, AlignCenter, AlignBottom, "OK:Send  Bk:Home");
+    const char* footer = snap->macro_set_count > 1 ? "OK:Send  <>:Set  Bk:Home" : "OK:Send  Bk:Home";
+    /* pin 1 is the one gesture both apps have; the BLE app's long Left/Right are taken */
+    if(snap->macro_pin_hint) footer = "Pin 1: Back+OK in Remote";
+    canvas_draw_str_aligned(canvas, 64, 62, AlignCenter, AlignBottom, footer);
 }
 
 /* ── Draw dispatcher ── */
 
 static void draw_callback(Canvas* canvas, void* ctx) {
-    ClaudeRemoteState* state = (ClaudeRemoteState*)ctx;
-    furi_mutex_acquire(state->mutex, FuriWaitForever);
+    RenderState* render = (RenderState*)ctx;
+#ifdef DIAG_MEMORY
+    uint8_t stack_anchor;
+    DiagPaint paint = diag_stack_paint();
+#endif
+    unsigned idx;
+    const RenderSnapshot* snap = render_acquire(render, &idx);
+    PROF_SCOPE(ProfRegionDraw);
 
-    switch(state->mode) {
+    switch(snap->mode) {
     case ModeSplash:
         draw_splash(canvas);
         break;
@@ -1751,29 +4861,36 @@ static void draw_callback(Canvas* canvas, void* ctx) {
         draw_home(canvas);
         break;
     case ModeRemote:
-        draw_remote(canvas, state);
+        if(snap->stats_visible) {
+            draw_stats(canvas, snap);
+        } else {
+            draw_remote(canvas, snap);
+        }
         break;
     case ModeManual:
-        switch(state->manual_view) {
+        switch(snap->manual_view) {
         case ManualViewCategories:
-            draw_manual_categories(canvas, state);
+            draw_manual_categories(canvas, snap);
             break;
         case ManualViewSections:
-            draw_manual_sections(canvas, state);
+            draw_manual_sections(canvas, snap);
             break;
         case ManualViewRead:
-            draw_manual_read(canvas, state);
+            draw_manual_read(canvas, snap);
             break;
         case ManualViewQuiz:
-            draw_manual_quiz(canvas, state);
+            draw_manual_quiz(canvas, snap);
+            break;
+        case ManualViewSearch:
+            draw_manual_search(canvas, snap);
             break;
         }
         break;
     case ModeSettings:
-        draw_settings(canvas, state);
+        draw_settings(canvas, snap);
         break;
     case ModeMacros:
-        draw_macros(canvas, state);
+        draw_macros(canvas, snap);
         break;
 #ifndef HID_TRANSPORT_BLE
     case ModeBlePromo:
@@ -1782,42 +4899,129 @@ static void draw_callback(Canvas* canvas, void* ctx) {
 #endif
     }
 
-    furi_mutex_release(state->mutex);
+#ifdef DIAG_MEMORY
+    uint32_t used = diag_stack_used(&stack_anchor, paint);
+    DiagMemory* diag = render->diag;
+    if(used > diag->draw_stack_max) diag->draw_stack_max = used;
+    diag->gui_stack_free = furi_thread_get_stack_space(furi_thread_get_current_id());
+    diag->screens_seen |= 1UL << diag_screen(snap);
+#endif
+
+    render_release(render, idx);
 }
 
 /* ── Input callback ── */
 
+/* Runs on the input service thread: never blocks, never touches app state. */
 static void input_callback(InputEvent* input_event, void* ctx) {
-    FuriMessageQueue* queue = (FuriMessageQueue*)ctx;
-    furi_message_queue_put(queue, input_event, FuriWaitForever);
+    PROF_SCOPE(ProfRegionInputCb);
+    InputRing* ring = (InputRing*)ctx;
+    InputKey key = input_event->key;
+    if(key >= InputKeyMAX) return;
+
+    InputType type = input_event->type;
+    bool release = type == InputTypeRelease;
+    if(atomic_load_explicit(&ring->release_lost, memory_order_acquire)) {
+        /* hold everything back until the consumer has caught up to the lost Release */
+        if(release) {
+            atomic_fetch_or_explicit(&ring->release_lost, 1UL << key, memory_order_release);
+        } else {
+            atomic_fetch_add_explicit(&ring->dropped, 1, memory_order_relaxed);
+        }
+        furi_thread_flags_set(ring->consumer, APP_FLAG_INPUT);
+        return;
+    }
+
+    if(type == InputTypeRepeat &&
+       atomic_fetch_add_explicit(&ring->repeat_pending[key], 1, memory_order_acq_rel) > 0) {
+        /* a Repeat for this key is still waiting — the count went into it */
+        atomic_fetch_add_explicit(&ring->coalesced, 1, memory_order_relaxed);
+        return;
+    }
+
+    unsigned head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    unsigned tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+    if(head - tail >= (release ? INPUT_RING_SIZE : INPUT_RING_SIZE - INPUT_RING_RESERVE)) {
+        if(release) {
+            /* handed out once the consumer has read what is queued ahead of it */
+            atomic_fetch_or_explicit(&ring->release_lost, 1UL << key, memory_order_release);
+            furi_thread_flags_set(ring->consumer, APP_FLAG_INPUT);
+        } else {
+            if(type == InputTypeRepeat) {
+                /* nothing queued carries the count: the next Repeat starts over */
+                atomic_store_explicit(&ring->repeat_pending[key], 0, memory_order_relaxed);
+            }
+            atomic_fetch_add_explicit(&ring->dropped, 1, memory_order_relaxed);
+        }
+        return;
+    }
+
+    InputRecord* rec = &ring->slots[head & (INPUT_RING_SIZE - 1)];
+    rec->key = key;
+    rec->type = type;
+    rec->repeats = 0;
+    atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+    furi_thread_flags_set(ring->consumer, APP_FLAG_INPUT);
+}
+
+/* Main loop side: pop the oldest record, folding in coalesced repeats. A Release
+ * that found the ring full comes out after everything queued before it. */
+static bool input_ring_pop(InputRing* ring, InputRecord* out) {
+    unsigned tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    unsigned head = atomic_load_explicit(&ring->head, memory_order_acquire);
+    if(tail == head && !ring->release_due) {
+        ring->release_due =
+            atomic_exchange_explicit(&ring->release_lost, 0, memory_order_acq_rel);
+    }
+    if(ring->release_due) {
+        InputKey key = (InputKey)__builtin_ctz(ring->release_due);
+        ring->release_due &= ring->release_due - 1;
+        *out = (InputRecord){.key = key, .type = InputTypeRelease, .repeats = 0};
+        return true;
+    }
+    if(tail == head) return false;
+
+    *out = ring->slots[tail & (INPUT_RING_SIZE - 1)];
+    atomic_store_explicit(&ring->tail, tail + 1, memory_order_release);
+
+    if(out->type == InputTypeRepeat) {
+        /* taking the count also reopens the key: a repeat arriving after this is queued fresh */
+        unsigned n = atomic_exchange_explicit(&ring->repeat_pending[out->key], 0, memory_order_acq_rel);
+        unsigned extra = n > 0 ? n - 1 : 0;
+        out->repeats = extra > UINT8_MAX ? UINT8_MAX : extra;
+    }
+    return true;
 }
 
 /* ══════════════════════════════════════════════
  *  Input handling
  * ══════════════════════════════════════════════ */
 
-static bool handle_home_input(ClaudeRemoteState* state, InputEvent* event, ViewPort* vp) {
+static bool handle_home_input(ClaudeRemoteState* state, InputRecord* event, ViewPort* vp) {
+#ifdef HID_TRANSPORT_BLE
+    /* Long-press OK → Remote with every key sent to USB and BT */
+    if(event->type == InputTypeLong && event->key == InputKeyOk) {
+        hid_select(state, HidOutputBoth);
+        state->mode = ModeRemote;
+        notify_led(state, LedBlue);
+        return true;
+    }
+#endif
     if(event->type != InputTypeShort) return true;
 
     switch(event->key) {
     case InputKeyOk:
 #ifdef HID_TRANSPORT_BLE
-        state->use_ble = false;
-        state->hid_connected = furi_hal_hid_is_connected();
+        hid_select(state, HidOutputUsb);
 #endif
         state->mode = ModeRemote;
-        if(state->led_enabled) {
-            notification_message(state->notifications, &sequence_solid_blue);
-        }
+        notify_led(state, LedBlue);
         break;
     case InputKeyRight:
 #ifdef HID_TRANSPORT_BLE
-        state->use_ble = true;
-        state->hid_connected = state->ble_connected;
+        hid_select(state, HidOutputBle);
         state->mode = ModeRemote;
-        if(state->led_enabled) {
-            notification_message(state->notifications, &sequence_solid_blue);
-        }
+        notify_led(state, LedBlue);
 #else
         state->mode = ModeBlePromo;
         view_port_set_orientation(vp, ViewPortOrientationHorizontal);
@@ -1829,28 +5033,20 @@ static bool handle_home_input(ClaudeRemoteState* state, InputEvent* event, ViewP
         state->scroll_offset = 0;
         state->manual_view = ManualViewCategories;
         state->mode = ModeManual;
-        if(state->led_enabled) {
-            notification_message(state->notifications, &sequence_solid_green);
-        }
+        notify_led(state, LedGreen);
         view_port_set_orientation(vp, ViewPortOrientationHorizontal);
         break;
     case InputKeyLeft:
         state->settings_index = 0;
         state->mode = ModeSettings;
-        if(state->led_enabled) {
-            notification_message(state->notifications, &sequence_solid_orange);
-        }
+        notify_led(state, LedOrange);
         view_port_set_orientation(vp, ViewPortOrientationHorizontal);
         break;
     case InputKeyUp:
-        if(!state->macros_loaded) {
-            load_macros_from_sd(state);
-        }
+        macros_request(state);
         state->macro_index = 0;
         state->mode = ModeMacros;
-        if(state->led_enabled) {
-            notification_message(state->notifications, &sequence_solid_orange);
-        }
+        notify_led(state, LedOrange);
         view_port_set_orientation(vp, ViewPortOrientationHorizontal);
         break;
     case InputKeyBack:
@@ -1863,67 +5059,55 @@ static bool handle_home_input(ClaudeRemoteState* state, InputEvent* event, ViewP
 
 static bool handle_remote_input(
     ClaudeRemoteState* state,
-    InputEvent* event,
+    InputRecord* event,
     ViewPort* view_port) {
-    if(event->type != InputTypeShort && event->type != InputTypeLong) return true;
-
-    if(event->key == InputKeyBack) {
-        if(event->type == InputTypeLong) {
-            /* Long-press Back → send Escape */
-            if(state->hid_connected) {
-                SEND_HID(state, HID_KEYBOARD_ESCAPE);
-                state->flash_label = "Esc";
-                state->flash_tick = furi_get_tick();
-                if(state->haptics_enabled) {
-                    notification_message(state->notifications, &sequence_single_vibro);
-                }
-            }
-        } else {
-            /* Short-press Back → go Home (discard pending key, don't send it) */
-            state->dc_pending = false;
-            state->mode = ModeHome;
-            if(state->led_enabled) {
-                notification_message(state->notifications, &sequence_solid_orange);
-            }
-            view_port_set_orientation(view_port, ViewPortOrientationVertical);
+    /* hold-to-scroll: Repeat continues it, Release stops it; a new press also ends
+     * it, in case that Release never came */
+    if(event->type == InputTypePress) state->scroll_dir = 0;
+    if(state->scroll_dir != 0 && (event->key == InputKeyUp || event->key == InputKeyDown)) {
+        if(event->type == InputTypeRelease) {
+            state->scroll_dir = 0;
+        } else if(event->type == InputTypeRepeat && state->hid_connected) {
+            scroll_step(state, 1 + event->repeats);
         }
         return true;
     }
 
-    /* Only process short presses for d-pad keys (long-press would trigger double-click) */
-    if(event->type != InputTypeShort) return true;
-
-#ifdef HID_TRANSPORT_BLE
-    if(!state->use_ble) {
-        state->hid_connected = furi_hal_hid_is_connected();
-    }
-#else
-    state->hid_connected = furi_hal_hid_is_connected();
-#endif
-    if(!state->hid_connected) return true;
-
-    /* All keys go through pending/deferred send for BLE reliability */
-    uint32_t now = furi_get_tick();
-    if(state->dc_pending && event->key == state->dc_key &&
-       (now - state->dc_tick) < DC_TIMEOUT_TICKS) {
-        /* double-click detected */
-        state->dc_pending = false;
-        send_double_action(state, event->key);
-    } else {
-        /* flush any different pending key first */
-        flush_pending_single(state);
-        /* start new pending */
-        state->dc_key = event->key;
-        state->dc_tick = now;
-        state->dc_pending = true;
+    /* hidden stats page: Back closes, Left/Right flips pages, long OK resets the counters;
+     * on the RTT page OK runs the probe, Back stops it, and long OK applies the suggested holds */
+    if(state->stats_visible) {
+        if(event->type != InputTypeShort && event->type != InputTypeLong) return true;
+        bool rtt_page = state->stats_page == StatsPageRtt;
+        if(event->type == InputTypeShort) {
+            if(event->key == InputKeyOk && rtt_page) {
+                rtt_run(state);
+            } else if(event->key == InputKeyBack && state->rtt.phase != RttIdle) {
+                rtt_stop(state);
+            } else if(event->key == InputKeyBack) {
+                state->stats_visible = false;
+            } else if(event->key == InputKeyRight) {
+                state->stats_page = (state->stats_page + 1) % StatsPageCount;
+            } else if(event->key == InputKeyLeft) {
+                state->stats_page = (state->stats_page + StatsPageCount - 1) % StatsPageCount;
+            }
+        } else if(event->key == InputKeyOk && rtt_page) {
+            rtt_apply(state);
+            state->flash_label = "Applied";
+            state->flash_tick = furi_get_tick();
+        } else if(event->key == InputKeyOk) {
+            memset(&state->stats, 0, sizeof(state->stats));
+            atomic_store(&state->intake.dropped, 0);
+        }
+        return true;
     }
 
+    gesture_input(state, event, view_port);
     return true;
 }
 
 /* ── Manual sub-view input handlers ── */
 
-static void handle_manual_categories(ClaudeRemoteState* state, InputEvent* event, ViewPort* vp) {
+static void handle_manual_categories(ClaudeRemoteState* state, InputRecord* event, ViewPort* vp) {
     switch(event->key) {
     case InputKeyUp:
         if(state->cat_index > 0) state->cat_index--;
@@ -1933,20 +5117,23 @@ static void handle_manual_categories(ClaudeRemoteState* state, InputEvent* event
         break;
     case InputKeyOk:
     case InputKeyRight:
+        state->search_opened = false;
         if(state->cat_index < CATEGORY_COUNT) {
             state->section_index = 0;
             state->manual_view = ManualViewSections;
-        } else {
+        } else if(state->cat_index == MENU_QUIZ) {
             /* quiz mode — show difficulty picker */
             state->quiz_selecting = true;
+            quiz_bank_check(state);
             state->manual_view = ManualViewQuiz;
+        } else {
+            state->search_in_hits = false;
+            state->manual_view = ManualViewSearch;
         }
         break;
     case InputKeyBack:
         state->mode = ModeHome;
-        if(state->led_enabled) {
-            notification_message(state->notifications, &sequence_solid_orange);
-        }
+        notify_led(state, LedOrange);
         view_port_set_orientation(vp, ViewPortOrientationVertical);
         break;
     default:
@@ -1954,7 +5141,7 @@ static void handle_manual_categories(ClaudeRemoteState* state, InputEvent* event
     }
 }
 
-static void handle_manual_sections(ClaudeRemoteState* state, InputEvent* event) {
+static void handle_manual_sections(ClaudeRemoteState* state, InputRecord* event) {
     const ManualCategory* cat = &categories[state->cat_index];
 
     switch(event->key) {
@@ -1978,11 +5165,11 @@ static void handle_manual_sections(ClaudeRemoteState* state, InputEvent* event)
     }
 }
 
-static void handle_manual_read(ClaudeRemoteState* state, InputEvent* event) {
+static void handle_manual_read(ClaudeRemoteState* state, InputRecord* event) {
     const ManualCategory* cat = &categories[state->cat_index];
-    const ManualSection* sec = &cat->sections[state->section_index];
-    uint16_t lines = count_lines(sec->content);
-    int max_scroll = lines > 4 ? lines - 4 : 0;
+    uint8_t id = manual_section_id(state->cat_index, state->section_index);
+    const ReadLayout* layout = &read_layouts[state->manual_dense];
+    int max_scroll = manual_max_scroll(layout, id);
 
     switch(event->key) {
     case InputKeyUp:
@@ -2003,18 +5190,35 @@ static void handle_manual_read(ClaudeRemoteState* state, InputEvent* event) {
             state->scroll_offset = 0;
         }
         break;
+    case InputKeyOk: {
+        /* dense view and back, keeping the top line's text at the top */
+        if(event->type != InputTypeShort) break;
+        uint32_t pos = manual_line_pos(layout, layout->first[id] + state->scroll_offset);
+        state->manual_dense = !state->manual_dense;
+        state->scroll_offset = manual_scroll_to(&read_layouts[state->manual_dense], id, pos);
+        settings_changed(state);
+        break;
+    }
     case InputKeyBack:
-        state->manual_view = ManualViewSections;
+        state->manual_view = state->search_opened ? ManualViewSearch : ManualViewSections;
         break;
     default:
         break;
     }
 }
 
-static void quiz_start(ClaudeRemoteState* state, uint8_t count) {
-    quiz_shuffle(state);
-    state->quiz_selecting = false;
+/* Back out of a quiz: to the search hit it came from, or the menu */
+static void quiz_leave(ClaudeRemoteState* state) {
+    state->manual_view = state->search_opened ? ManualViewSearch : ManualViewCategories;
+}
+
+static void quiz_reset(ClaudeRemoteState* state, bool bank, uint8_t count) {
+    state->quiz_seq++;
+    state->quiz_from_bank = bank;
     state->quiz_count = count;
+    state->quiz_scanning = false;
+    state->quiz_boxes_ready = false;
+    state->quiz_selecting = false;
     state->quiz_index = 0;
     state->quiz_correct = 0;
     state->quiz_total = 0;
@@ -2024,15 +5228,35 @@ static void quiz_start(ClaudeRemoteState* state, uint8_t count) {
     state->quiz_answered = false;
 }
 
-static void handle_manual_quiz(ClaudeRemoteState* state, InputEvent* event) {
+/* bank: draw from quiz.bank rather than the built-in cards. The round
+ * shows "Loading..." until its cards are picked; if the last round's scan
+ * still owns quiz_scan, this one's is sent once that reports back. */
+static void quiz_start(ClaudeRemoteState* state, uint8_t count, bool bank) {
+    uint16_t total = bank ? state->quiz_bank_count : QUIZ_CARD_COUNT;
+    quiz_reset(state, bank, count < total ? count : total);
+    state->quiz_scanning = true;
+    if(state->quiz_scan_pending) {
+        state->quiz_start_queued = true;
+        return;
+    }
+    quiz_scan_begin(state);
+}
+
+/* a one-question round with a built-in card, outside the schedule */
+static void quiz_open_card(ClaudeRemoteState* state, uint16_t card) {
+    quiz_reset(state, false, 1);
+    state->quiz_order[0] = card;
+}
+
+static void handle_manual_quiz(ClaudeRemoteState* state, InputRecord* event) {
     /* difficulty picker */
     if(state->quiz_selecting) {
         switch(event->key) {
-        case InputKeyLeft:  quiz_start(state, 8);  return;
-        case InputKeyUp:    quiz_start(state, 16); return;
-        case InputKeyRight: quiz_start(state, 24); return;
+        case InputKeyLeft:  quiz_start(state, 8, state->quiz_bank_count > 0);  return;
+        case InputKeyUp:    quiz_start(state, 16, state->quiz_bank_count > 0); return;
+        case InputKeyRight: quiz_start(state, 24, state->quiz_bank_count > 0); return;
         case InputKeyBack:
-            state->manual_view = ManualViewCategories;
+            quiz_leave(state);
             return;
         default: return;
         }
@@ -2042,14 +5266,14 @@ static void handle_manual_quiz(ClaudeRemoteState* state, InputEvent* event) {
     if(state->quiz_index >= state->quiz_count) {
         if(event->key == InputKeyOk) {
             state->quiz_selecting = true;
+            quiz_bank_check(state);
         } else if(event->key == InputKeyBack) {
-            state->manual_view = ManualViewCategories;
+            quiz_leave(state);
         }
         return;
     }
 
-    uint8_t real_index = state->quiz_order[state->quiz_index];
-    const QuizCard* card = &quiz_cards[real_index];
+    const QuizCard* card = quiz_current(state); /* NULL while its record loads */
 
     /* multi-choice input */
     {
@@ -2058,8 +5282,9 @@ static void handle_manual_quiz(ClaudeRemoteState* state, InputEvent* event) {
                 state->quiz_index++;
                 state->quiz_selected = -1;
                 state->quiz_answered = false;
+                quiz_card_request(state);
             } else if(event->key == InputKeyBack) {
-                state->manual_view = ManualViewCategories;
+                quiz_leave(state);
             }
         } else {
             int8_t picked = -1;
@@ -2068,14 +5293,15 @@ static void handle_manual_quiz(ClaudeRemoteState* state, InputEvent* event) {
             case InputKeyUp:    picked = 1; break;
             case InputKeyRight: picked = 2; break;
             case InputKeyBack:
-                state->manual_view = ManualViewCategories;
+                quiz_leave(state);
                 return;
             default: break;
             }
-            if(picked >= 0) {
+            if(picked >= 0 && card) {
                 state->quiz_selected = picked;
                 state->quiz_answered = true;
                 state->quiz_total++;
+                quiz_box_record(state, picked == card->correct_option);
                 if(picked == card->correct_option) {
                     state->quiz_correct++;
                     state->quiz_streak++;
@@ -2089,29 +5315,114 @@ static void handle_manual_quiz(ClaudeRemoteState* state, InputEvent* event) {
     }
 }
 
-static bool handle_manual_input(ClaudeRemoteState* state, InputEvent* event, ViewPort* vp) {
-    if(event->type != InputTypeShort && event->type != InputTypeRepeat) return true;
+/* picker: <> letter, OK add, Back delete (or leave), Down to the hits.
+ * hits: Up/Down move (Up past the first returns to the picker), OK open. */
+static void handle_manual_search(ClaudeRemoteState* state, InputRecord* event) {
+    uint8_t count = sizeof(search_alphabet) - 1;
+
+    if(state->search_in_hits) {
+        switch(event->key) {
+        case InputKeyUp:
+            if(state->search_hit_index > 0) {
+                state->search_hit_index--;
+            } else {
+                state->search_in_hits = false;
+            }
+            break;
+        case InputKeyDown:
+            if(state->search_hit_index < state->search_hit_count - 1) state->search_hit_index++;
+            break;
+        case InputKeyOk:
+        case InputKeyRight: {
+            uint16_t hit = state->search_hits[state->search_hit_index];
+            uint8_t cat, section;
+            state->search_opened = true;
+            if(search_doc_section(hit >> 8, &cat, &section)) {
+                /* the wrapped line holding the hit's source line, at the top
+                 * as far as the reader scrolls */
+                ManualCursor cursor = {categories[cat].sections[section].content, NULL};
+                uint32_t pos = manual_seek_line(&cursor, hit & 0xFF);
+                state->cat_index = cat;
+                state->section_index = section;
+                state->scroll_offset =
+                    manual_scroll_to(&read_layouts[state->manual_dense], hit >> 8, pos);
+                state->manual_view = ManualViewRead;
+            } else {
+                quiz_open_card(state, (hit >> 8) - SEARCH_SECTION_COUNT);
+                state->manual_view = ManualViewQuiz;
+            }
+            break;
+        }
+        case InputKeyBack:
+        case InputKeyLeft:
+            state->search_in_hits = false;
+            break;
+        default:
+            break;
+        }
+        return;
+    }
 
-    switch(state->manual_view) {
-    case ManualViewCategories:
-        handle_manual_categories(state, event, vp);
+    switch(event->key) {
+    case InputKeyLeft:
+        state->search_char = (state->search_char + count - 1) % count;
+        break;
+    case InputKeyRight:
+        state->search_char = (state->search_char + 1) % count;
+        break;
+    case InputKeyOk:
+        if(state->search_len == SEARCH_QUERY_MAX) break;
+        state->search_query[state->search_len++] = search_alphabet[state->search_char];
+        state->search_query[state->search_len] = '\0';
+        search_run(state);
         break;
-    case ManualViewSections:
-        handle_manual_sections(state, event);
+    case InputKeyDown:
+        if(state->search_hit_count > 0) state->search_in_hits = true;
         break;
-    case ManualViewRead:
-        handle_manual_read(state, event);
+    case InputKeyBack:
+        if(state->search_len == 0) {
+            state->manual_view = ManualViewCategories;
+            break;
+        }
+        state->search_query[--state->search_len] = '\0';
+        search_run(state);
         break;
-    case ManualViewQuiz:
-        handle_manual_quiz(state, event);
+    default:
         break;
     }
+}
+
+static bool handle_manual_input(ClaudeRemoteState* state, InputRecord* event, ViewPort* vp) {
+    if(event->type != InputTypeShort && event->type != InputTypeRepeat) return true;
+
+    /* coalesced repeats scroll/step as many times as the button repeated */
+    uint16_t steps = event->type == InputTypeRepeat ? 1 + event->repeats : 1;
+    while(steps--) {
+        switch(state->manual_view) {
+        case ManualViewCategories:
+            handle_manual_categories(state, event, vp);
+            break;
+        case ManualViewSections:
+            handle_manual_sections(state, event);
+            break;
+        case ManualViewRead:
+            handle_manual_read(state, event);
+            break;
+        case ManualViewQuiz:
+            handle_manual_quiz(state, event);
+            break;
+        case ManualViewSearch:
+            handle_manual_search(state, event);
+            break;
+        }
+        if(state->mode != ModeManual) break;
+    }
     return true;
 }
 
 /* ── Settings input handler ── */
 
-static bool handle_settings_input(ClaudeRemoteState* state, InputEvent* event, ViewPort* vp) {
+static bool handle_settings_input(ClaudeRemoteState* state, InputRecord* event, ViewPort* vp) {
     if(event->type != InputTypeShort) return true;
 
     switch(event->key) {
@@ -2126,16 +5437,26 @@ static bool handle_settings_input(ClaudeRemoteState* state, InputEvent* event, V
             state->haptics_enabled = !state->haptics_enabled;
         } else if(state->settings_index == 1) {
             state->led_enabled = !state->led_enabled;
+            notify_led(state, state->led_enabled ? LedOrange : LedOff);
         } else if(state->settings_index == 2) {
             state->os_mode = (state->os_mode + 1) % 3;
+            keymap_select(state, state->keymap_want);
+        } else if(state->settings_index == 3) {
+            state->scroll_mode = state->scroll_mode == ScrollModePage ? ScrollModeWheel : ScrollModePage;
+        } else if(state->settings_index == 4) {
+            uint8_t i = 0;
+            while(i < COUNT_OF(tap_window_steps) && tap_window_steps[i] <= state->gesture.tap_ms) i++;
+            state->gesture.tap_ms = tap_window_steps[i % COUNT_OF(tap_window_steps)];
+        } else if(state->settings_index == 5) {
+            state->macro_sort = state->macro_sort == MacroSortUsage ? MacroSortFile : MacroSortUsage;
+            macro_order_build(state);
         }
-        save_settings(state);
+        settings_changed(state);
         break;
     case InputKeyBack:
+        settings_flush(state);
         state->mode = ModeHome;
-        if(state->led_enabled) {
-            notification_message(state->notifications, &sequence_solid_orange);
-        }
+        notify_led(state, LedOrange);
         view_port_set_orientation(vp, ViewPortOrientationVertical);
         break;
     default:
@@ -2146,8 +5467,15 @@ static bool handle_settings_input(ClaudeRemoteState* state, InputEvent* event, V
 
 /* ── Macros input handler ── */
 
-static bool handle_macros_input(ClaudeRemoteState* state, InputEvent* event, ViewPort* vp) {
+static bool handle_macros_input(ClaudeRemoteState* state, InputRecord* event, ViewPort* vp) {
+    if(event->type == InputTypeLong && event->key == InputKeyOk) {
+        if(state->macro_count > 0) {
+            macro_pin(state, state->macros[state->macro_order[state->macro_index]]);
+        }
+        return true;
+    }
     if(event->type != InputTypeShort) return true;
+    state->macro_pin_hint = false;
 
     switch(event->key) {
     case InputKeyUp:
@@ -2159,19 +5487,28 @@ static bool handle_macros_input(ClaudeRemoteState* state, InputEvent* event, Vie
         break;
     case InputKeyOk:
         if(state->macro_count > 0 && state->hid_connected) {
-            /* Release mutex during macro send so draw_callback isn't blocked */
-            char macro_buf[MACRO_MAX_LEN + 1];
-            memcpy(macro_buf, state->macros[state->macro_index], sizeof(macro_buf));
-            furi_mutex_release(state->mutex);
-            send_macro_string(state, macro_buf);
-            furi_mutex_acquire(state->mutex, FuriWaitForever);
+            const char* text = state->macros[state->macro_order[state->macro_index]];
+            send_macro_string(state, text);
+            macro_use_record(state, text);
+        }
+        break;
+    case InputKeyLeft:
+    case InputKeyRight: {
+        /* one set read in flight at a time: they share macro_io, and a
+         * pending index refresh would renumber the sets */
+        uint8_t count = state->macro_sets.count;
+        if(!state->macro_sets_ready || state->macros_loading || state->macro_index_pending ||
+           count < 2) {
+            break;
         }
+        uint8_t step = event->key == InputKeyRight ? 1 : count - 1;
+        macro_set_load(state, (state->macro_set + step) % count, false);
+        settings_changed(state);
         break;
+    }
     case InputKeyBack:
         state->mode = ModeHome;
-        if(state->led_enabled) {
-            notification_message(state->notifications, &sequence_solid_orange);
-        }
+        notify_led(state, LedOrange);
         view_port_set_orientation(vp, ViewPortOrientationVertical);
         break;
     default:
@@ -2192,19 +5529,43 @@ static int32_t claude_remote_main(void* p) {
     memset(state, 0, sizeof(ClaudeRemoteState));
     state->mode = ModeSplash;
     state->splash_start = furi_get_tick();
-    state->mutex = furi_mutex_alloc(FuriMutexTypeNormal);
+#ifdef PROFILE_CYCLES
+    prof_init();
+    uint32_t prof_log_tick = furi_get_tick();
+#endif
 
     state->notifications = furi_record_open(RECORD_NOTIFICATION);
+    storage_worker_start(&state->io, furi_thread_get_current_id());
+    keymap_scan(state);
     load_settings(state);
-    if(state->led_enabled) {
-        notification_message(state->notifications, &sequence_solid_orange);
+    storage_read(
+        &state->io, StorageTagMacroPins, 0, MACRO_PIN_PATH, 0, state->pin_io,
+        sizeof(state->pin_io) - 1);
+    quiz_bank_check(state);
+    /* the defaults until the saved profile arrives from the worker */
+    state->keymap = &state->keymaps[0];
+    keymap_defaults(state->keymap, state->os_mode);
+    keymap_finish(state->keymap);
+    keymap_select(state, state->keymap_index);
+    state->gesture.pending = InputKeyMAX;
+    notify_led(state, LedOrange);
+
+    state->intake.consumer = furi_thread_get_current_id();
+    state->link.consumer = state->intake.consumer;
+    for(int i = 0; i < LinkCount; i++) {
+        atomic_store(&state->link.changed_tick[i], state->splash_start);
     }
 
-    FuriMessageQueue* queue = furi_message_queue_alloc(8, sizeof(InputEvent));
+#ifdef DIAG_MEMORY
+    /* stack_size from application.fam, read back rather than restated here */
+    state->diag.main_stack_size = furi_thread_get_stack_size(furi_thread_get_current());
+    state->render.diag = &state->diag;
+#endif
+    render_publish(state);
 
     ViewPort* view_port = view_port_alloc();
-    view_port_draw_callback_set(view_port, draw_callback, state);
-    view_port_input_callback_set(view_port, input_callback, queue);
+    view_port_draw_callback_set(view_port, draw_callback, &state->render);
+    view_port_input_callback_set(view_port, input_callback, &state->intake);
 
     /* landscape for splash screen */
     view_port_set_orientation(view_port, ViewPortOrientationHorizontal);
@@ -2212,41 +5573,63 @@ static int32_t claude_remote_main(void* p) {
     Gui* gui = furi_record_open(RECORD_GUI);
     gui_add_view_port(gui, view_port, GuiLayerFullscreen);
 
-    /* Init USB HID (both builds) */
-    state->usb_prev = furi_hal_usb_get_config();
-    furi_hal_usb_unlock();
-    furi_hal_usb_set_config(&usb_hid, NULL);
-
 #ifdef HID_TRANSPORT_BLE
-    /* Also init BLE HID */
-    state->bt = furi_record_open(RECORD_BT);
-    bt_disconnect(state->bt);
-    furi_delay_ms(200);
-    state->ble_profile = bt_profile_start(state->bt, ble_profile_hid, NULL);
-    bt_set_status_changed_callback(state->bt, bt_status_callback, state);
-    FURI_LOG_I(TAG, "BLE + USB HID profiles started");
+    /* BLE HID comes up at launch so hosts can reconnect during the splash;
+     * USB HID is only started if USB is picked on the Home screen */
+    hid_ble_start(state);
+    hid_select(state, HidOutputBle);
+    FURI_LOG_I(TAG, "BLE HID profile started");
+#else
+    hid_usb_start(state);
 #endif
+    link_refresh(state);
 
-    InputEvent event;
+    InputRecord event;
     bool running = true;
 
     while(running) {
-        FuriStatus status = furi_message_queue_get(queue, &event, 100);
+        /* wake on input, or when a waiting tap's window closes */
+        uint32_t timeout = 100;
+        uint32_t tap_timeout = gesture_timeout(state);
+        if(tap_timeout < timeout) timeout = tap_timeout;
+        uint32_t haptic_timeout = notify_timeout(state);
+        if(haptic_timeout < timeout) timeout = haptic_timeout;
+        uint32_t probe_timeout = rtt_timeout(state);
+        if(probe_timeout < timeout) timeout = probe_timeout;
+        if(state->settings_dirty) {
+            uint32_t idle = furi_get_tick() - state->settings_tick;
+            uint32_t due = idle >= SETTINGS_IDLE_TICKS ? 0 : SETTINGS_IDLE_TICKS - idle;
+            if(due < timeout) timeout = due;
+        }
+        if(state->render.dirty && timeout > RENDER_RETRY_TICKS) timeout = RENDER_RETRY_TICKS;
+        uint32_t flags = furi_thread_flags_wait(
+            APP_FLAG_INPUT | APP_FLAG_LINK | APP_FLAG_STORAGE, FuriFlagWaitAny, timeout);
+        if(flags & FuriFlagError) flags = 0; /* timeout */
+
+        state->stats.drops = atomic_load(&state->intake.dropped);
 
-        furi_mutex_acquire(state->mutex, FuriWaitForever);
+        if(flags & APP_FLAG_STORAGE) {
+            StorageDone done;
+            while(furi_message_queue_get(state->io.done, &done, 0) == FuriStatusOk) {
+                storage_complete(state, &done);
+            }
+        }
 
         /* auto-advance splash after 3 seconds, or skip on any press */
         if(state->mode == ModeSplash) {
-            if(status == FuriStatusOk || (furi_get_tick() - state->splash_start) >= 3000) {
+            bool pressed = false;
+            while(input_ring_pop(&state->intake, &event)) pressed = true;
+            if(pressed || (furi_get_tick() - state->splash_start) >= 3000) {
                 state->mode = ModeHome;
                 view_port_set_orientation(view_port, ViewPortOrientationVertical);
             }
-            furi_mutex_release(state->mutex);
+            render_publish(state);
             view_port_update(view_port);
             continue;
         }
 
-        if(status == FuriStatusOk) {
+        while(running && input_ring_pop(&state->intake, &event)) {
+            PROF_SCOPE(ProfRegionInput);
             switch(state->mode) {
             case ModeSplash:
                 break; /* handled above */
@@ -2269,9 +5652,7 @@ static int32_t claude_remote_main(void* p) {
             case ModeBlePromo:
                 if(event.type == InputTypeShort && event.key == InputKeyBack) {
                     state->mode = ModeHome;
-                    if(state->led_enabled) {
-                        notification_message(state->notifications, &sequence_solid_orange);
-                    }
+                    notify_led(state, LedOrange);
                     view_port_set_orientation(view_port, ViewPortOrientationVertical);
                 }
                 break;
@@ -2279,49 +5660,67 @@ static int32_t claude_remote_main(void* p) {
             }
         }
 
-        if(state->mode == ModeRemote || state->mode == ModeMacros) {
-#ifdef HID_TRANSPORT_BLE
-            if(state->use_ble) {
-                state->hid_connected = state->ble_connected;
-            } else {
-                state->hid_connected = furi_hal_hid_is_connected();
-            }
-#else
-            state->hid_connected = furi_hal_hid_is_connected();
-#endif
-            /* flush pending single-press after double-click timeout (remote only) */
-            if(state->mode == ModeRemote && state->dc_pending &&
-               (furi_get_tick() - state->dc_tick) >= DC_TIMEOUT_TICKS) {
-                flush_pending_single(state);
-            }
+        if(flags & APP_FLAG_LINK) {
+            link_refresh(state);
+        }
+
+        if(state->settings_dirty && furi_get_tick() - state->settings_tick >= SETTINGS_IDLE_TICKS) {
+            settings_flush(state);
+        }
+
+        /* pick up edits to the macro files without a restart */
+        if(state->mode == ModeMacros &&
+           furi_get_tick() - state->macro_check_tick >= MACRO_RECHECK_TICKS) {
+            macros_request(state);
         }
 
-        furi_mutex_release(state->mutex);
+        /* send a waiting tap once its multi-tap window closes (remote only) */
+        if(state->mode == ModeRemote && gesture_timeout(state) == 0) {
+            gesture_flush(state, view_port);
+        }
+
+        if(state->rtt.phase != RttIdle) rtt_tick(state);
+
+        notify_flush(state);
+
+#ifdef DIAG_MEMORY
+        diag_sample(state);
+#endif
+        render_publish(state);
         view_port_update(view_port);
+
+#ifdef PROFILE_CYCLES
+        if(furi_get_tick() - prof_log_tick >= PROF_LOG_INTERVAL_TICKS) {
+            prof_log_tick = furi_get_tick();
+            prof_log();
+        }
+#endif
     }
 
     FURI_LOG_I(TAG, "Exiting Claupper");
+#ifdef PROFILE_CYCLES
+    prof_log();
+#endif
+#ifdef DIAG_MEMORY
+    diag_log(state);
+#endif
+
+    rtt_finish(state);
+    save_stats(state);
+    settings_flush(state);
+    storage_worker_stop(&state->io);
 
     notification_message(state->notifications, &sequence_reset_rgb);
     furi_record_close(RECORD_NOTIFICATION);
 
-    /* Cleanup USB HID (both builds) */
-    furi_hal_hid_kb_release_all();
-    furi_hal_usb_set_config(state->usb_prev, NULL);
-
+    hid_usb_stop(state);
 #ifdef HID_TRANSPORT_BLE
-    /* Also cleanup BLE HID */
-    bt_set_status_changed_callback(state->bt, NULL, NULL);
-    ble_profile_hid_kb_release_all(state->ble_profile);
-    bt_profile_restore_default(state->bt);
-    furi_record_close(RECORD_BT);
+    hid_ble_stop(state);
 #endif
 
     gui_remove_view_port(gui, view_port);
     furi_record_close(RECORD_GUI);
     view_port_free(view_port);
-    furi_message_queue_free(queue);
-    furi_mutex_free(state->mutex);
     free(state);
 
     return 0;
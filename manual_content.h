@@ -0,0 +1,587 @@
+/* Generated by tools/gen_manual.py from manual/manual.txt. Do not edit. */
+
+/* section text: 7932 bytes as written, 5981 interned (128 fragments) */
+static const char* const manual_fragments[] = {
+    "laude",
+    "\n   ",
+    "ettings",
+    " project",
+    " file",
+    "CLAUDE.md",
+    " to ",
+    "tion",
+    " session",
+    " in ",
+    "\n\nStep ",
+    "your",
+    "model",
+    "comm",
+    "and ",
+    "s:\n ",
+    "t ANTHROPIC_API_KEY",
+    "review",
+    "\n - ",
+    " or ",
+    "ermission",
+    " con",
+    ".json",
+    " directory",
+    " for",
+    " reads",
+    "prompt",
+    "    ",
+    " history\n",
+    " issues",
+    ":\n c",
+    "erminal",
+    "pprov",
+    "tart",
+    " key",
+    "--output-format json\n\n",
+    "arch",
+    "code",
+    "it\n ",
+    "kill",
+    "test",
+    "vers",
+    " Type ",
+    " token",
+    "after ",
+    "cture",
+    "onfig",
+    "\n  -",
+    "Commit ",
+    "Project",
+    "current",
+    "ing\n",
+    "tern",
+    "tool",
+    " with",
+    "ads automatically",
+    "input",
+    "login",
+    "ustom",
+    " res",
+    " the",
+    "Use ",
+    "before",
+    "ents",
+    "text",
+    " changes",
+    "/compact",
+    "nthropic",
+    "\n\nRe",
+    "\n --",
+    " -p \"",
+    " can ",
+    " out",
+    " run ",
+    "=sk-ant-...\n\n",
+    "Tool",
+    "able",
+    "enera",
+    "mple",
+    "replace",
+    "sage",
+    "scri",
+    "tes ",
+    "\n Find",
+    "\n Run ",
+    " GitHub PR ",
+    " found",
+    " fresh",
+    ":\n 1. ",
+    "Step 1",
+    "ecline",
+    "nstall",
+    "query\"",
+    "\n Pa",
+    "\n Re",
+    "\n Se",
+    " API",
+    " int",
+    " npm",
+    " pat",
+    " sta",
+    ".\n\nS",
+    ":\n C",
+    "Auto",
+    "Code",
+    "Node.js 18",
+    "Open",
+    "ance",
+    "ands",
+    "base",
+    "chat",
+    "cost",
+    "ding",
+    "dit ",
+    "ende",
+    "est ",
+    "etch",
+    "etup",
+    "git repo\n ",
+    "port",
+    "s.\n\n",
+    "\n\nTip",
+    " feedback",
+    " root",
+    "anage",
+    "like ",
+    "milestone",
+    "ponse",
+};
+
+static const ManualSection getting_started_sections[] = {
+    {"Installing Claude",
+     "I\333 via\342:\n"
+     "\342 i -g @a\303-ai/\201c\200-\245\n"
+     "\n"
+     "Or via brew:\n"
+     " brew i\333 c\200-\245\304quires \351+\n"
+     "\216an A\303\340\242\345et \213\242:\n"
+     " expor\220\201\312Or log\211with\236\200 \271\n"},
+    {"First Launch",
+     "\352 any t\237 \216type\236\200\n"
+     "\n"
+     "C\200 s\241s\211\213\n"
+     "\262\227. It\231\n"
+     "all\204s\211\213\203\345\241\327\236\200 --new\304sume last\210\236\200 --continue\n"
+     "\n"
+     "Print mode (no \356)\236\200\306\213 \334\n"
+     "\n"
+     "Type \213 requ\363at\274\n"
+     "> \232 \216press Enter.\n"},
+    {"System Requirements",
+     "Sup\367ed platform\217macOS, Linux, WSL\304quirement\217\351\223later\n"
+     "\342\223brew\n"
+     " T\237\266 UTF-8\304\215\362d:\n"
+     " Git i\333ed\n"
+     " \261\211a \366\205 in\203\373\n"
+     "\n"
+     "API\242\223C\200 \271\n"
+     "required\230 opera\207.\n"},
+    {"Authentication",
+     "Two ways\206authenticate:\n"
+     "\n"
+     "1. C\200 Max sub\321p\207\201c\200 \271\201\352s browser\206sign in\n"
+     "\n"
+     "2.\340\242\201expor\220\201  \312M\374\210\217/\271   sign\211again\n"
+     " /logout  sign\310\n"
+     " /status  check auth\344te\n"
+     "\n"
+     "Max: flat monthly rate.\n"
+     "API: pay per\253 used.\n"},
+};
+
+static const ManualSection workspace_sections[] = {
+    {"Ideal Project Setup",
+     "Best\273ults when C\200\n"
+     "can see \213 full\203.\304\215\362d layout:\n"
+     "\203/\201\205\201.c\200/\201src/\201\250s/\201package\226\n"
+     "\n"
+     "Always\311c\200 from\n"
+     "\213\203\373 dir.\n"
+     "\n"
+     "Keep\203s\211git so\n"
+     "C\200\307see\234\216you\307revert.\n"},
+    {"CLAUDE.md Guide",
+     "\205 is a\204 C\200\n"
+     "re\267 when\n"
+     "s\241ing\211a\227.\n"
+     "\n"
+     "\275it\206tell C\200:\222\261 de\321p\207\222Archite\255 notes\222Co\360\225ven\207s\222Build/\250 \215\354\222Key\204 loca\207s\n"
+     "\n"
+     "C\200\231 \205 at\n"
+     "every\210 s\241. No\n"
+     "need\206repeat\225\300.\n"
+     "\n"
+     "Place it in\203\373.\n"},
+    {"The /init Command",
+     "/init crea\322a \205\n"
+     "for \213\203.\n"
+     "\n"
+     "U\320\330\352 c\200\211\213\201\203\227\n"
+     " 2.\252/in\2463. C\200 analyzes \213\201 \245\355\n"
+     " 4. G\315\322a \205\n"
+     "\n"
+     "The\204 include\217- Tech\344ck details\222\261 stru\255\222Build \215\354\222Co\360\343\264s\326\n"
+     "\n"
+     "E\361it\206add \213 own\n"
+     "instruc\207s\223rules.\n"},
+    {".claude/ Directory",
+     "The .c\200/\227\n"
+     "stores\203 s\202\345tru\255:\n"
+     " .c\200/\201s\202\226\201s\247s/\201  c\272_s\247.md\n"
+     "\n"
+     "s\202\226:\n"
+     " Stores allowed \265s\n"
+     " \216p\224\370s\247s/\346\272 s\247\204s\n"
+     " C\200 loads on s\241.\n"
+     "\n"
+     "\260.c\200/\206share\n"
+     "c\256\266 \213 team.\n"},
+    {"Skills System",
+     "S\247s are reus\314 \232s\n"
+     "C\200 lo\267.\n"
+     "\n"
+     "Loca\207:\n"
+     " .c\200/s\247s/*.md\n"
+     "\n"
+     "Each .md\204 is a s\247.\n"
+     "C\200\231\274m at s\241\n"
+     "\375\205.\n"
+     "\n"
+     "Use\230:\222C\272 workflows\222\350 \221 rules\222Res\377 templates\222Domain knowledge\n"
+     "\n"
+     "S\247s \317\274 old\n"
+     "c\272 slash \215\354.\n"},
+};
+
+static const ManualSection commands_sections[] = {
+    {"Navigation & Basics",
+     "Key shortcut\217Ctrl+C C\353l/interrupt\n"
+     " Ctrl+D Exit C\200 \350\n"
+     " Esc\233C\353l \270\n"
+     " Tab\233\347co\316te\n"
+     "\n"
+     "A\240al \232\2171  Yes / a\240e\n"
+     " 2  No / d\332\n"
+     " 3  Other / al\264ative\n"
+     "\n"
+     "Scrolling:\n"
+     " Up/Down\230\234\n"
+     "Voice (macOS):\n"
+     " Down  S\241 Dicta\207\n"},
+    {"Session Management",
+     "/clear\n"
+     " Wipe\225\251a\207\234 S\241\327\211same dir\n"
+     "\n"
+     "\302\n"
+     " Summarize\225\251a\207\336duces\253 u\320\n"
+     " \275when\225\300 is big\n"
+     "\n"
+     "/\357\n"
+     " Show\253 u\320 and\n"
+     " estimated \357\230\n"
+     " \262\210\n"
+     "\n"
+     "Sessions persist. Use\305continue\206resume\305new\206s\241\327\n"},
+    {"Configuration",
+     "/c\256\n"
+     " \352 s\202 editor\337t \214,\274me,\242\n"
+     "\n"
+     "/t\237-s\365\n"
+     " Fix t\237 r\362r\263 \216display\235\n"
+     "\n"
+     "Key s\202:\n"
+     " Model selec\207\n"
+     " \347-a\240e\343\264s\n"
+     " Theme (light/dark)\n"
+     " Notifica\207 sounds\n"
+     "\n"
+     "S\202 stored in:\n"
+     " ~/.c\200/c\256\226\n"},
+    {"Debugging",
+     "/doctor\n"
+     " Diagnose s\365\235\n"
+     " Check\340\225nec\207\n"
+     " Verify p\224s\n"
+     "\n"
+     "Common\235:\n"
+     "\n"
+     " \"API\242 not\326\"\257> ex\367 \213\242\n"
+     "\n"
+     " \"P\224 denied\"\257> Check /c\256\n"
+     "\n"
+     " Slow\273\377\217 -> \302\206reduce\201 \225\251a\207 size\n"
+     "\n"
+     " Display broken:\257> /t\237-s\365\n"},
+    {"Slash Commands A-M",
+     "/bug\336\367 a C\200 \350 bug\n"
+     "\n"
+     "/\215\246\347-g\315te a \215\246mes\320 \216\215it\n"
+     "\n"
+     "/listen\335use \216wait\230\n"
+     "\204\301\206resume\n"
+     "\n"
+     "/\271\n"
+     " Sign in\206A\303\n"
+     "\n"
+     "/logout\n"
+     " Sign\310 of\210\n"
+     "\n"
+     "/memory\n"
+     " E\361\205 quickly\n"
+     "\n"
+     "/\214\n"
+     " Switch AI \214 mid-\356\n"
+     " Opus, Sonnet,\223Haiku\n"
+     "\n"
+     "/mcp\n"
+     " M\374 MCP ser\251\n"},
+    {"Slash Commands N-Z",
+     "/p\224s\n"
+     " View \216e\361\265\n"
+     " access\230 this\210\n"
+     "\n"
+     "/pr-\215\277\n"
+     " F\364\325\221\n"
+     " \215\277\341o\210\n"
+     "\n"
+     "/rewind\n"
+     " Undo\206a previous\n"
+     " point\211con\251a\207\n"
+     "\n"
+     "/status\n"
+     " Show auth, \214, and\n"
+     "\210 info\n"
+     "\n"
+     "/vim\n"
+     " Toggle vim\242bin\360s\n"
+     "\211the \270 editor\n"},
+};
+
+static const ManualSection tools_sections[] = {
+    {"File Operations",
+     "Read\n"
+     " View\204\225t\277\n"
+     " Sup\367s images & PDFs\n"
+     "\n"
+     "Write\n"
+     " Create new\204s\n"
+     " Overwri\322if exists\n"
+     "\n"
+     "Ed\246Modify existing\204s\323 \216\317 \300\n"
+     " Preserves\225\300\n"
+     "\n"
+     "NotebookEd\246E\361Jupyter notebooks\n"
+     " Add/remove/\317 cells\n"},
+    {"Search & Explore",
+     "Grep\337\244\204\225t\277\336gex\343\264 match\263 Filter by\204 type\n"
+     "\n"
+     "Glob\323\204s by name\335t\264 match\263 e.g. \"**/*.ts\"\n"
+     "\n"
+     "Task (Explore agent)\337\244 across \245\355\323 i\316menta\207s\n"
+     " Answer \244ite\255 Q's\n"
+     "\n"
+     "Let C\200 se\244 rather\n"
+     "than pasting\204\343hs.\n"},
+    {"Sub-agents & Web",
+     "Task\n"
+     " Launch sub-agent\217Bash, Explore, Plan,\n"
+     " g\315l-purpose\n"
+     "\n"
+     "Bash\324shell \215\354\n"
+     " Git,\342, \250s, builds\n"
+     "\n"
+     "WebF\364\n"
+     " F\364 \216analyze URLs\n"
+     "\n"
+     "WebSe\244\337\244\274 in\264et\n"
+     " Get \262 info\n"
+     "\n"
+     "Ag\277\311indep\362ntly\n"
+     "\216return\273ults.\n"},
+};
+
+static const ManualSection workflows_sections[] = {
+    {"New Project Setup",
+     "\331\236\200 --new\2122:\n"
+     "\252/in\246Crea\322\205\2123:\n"
+     " De\321be what you want.\n"
+     " Be specific about\n"
+     " \213 tech\344ck.\2124:\n"
+     " A\240e ac\207s\266 1\n"
+     " D\332\266 2\371: \260\254each\n"
+     "major \376.\n"},
+    {"Debug & Test",
+     "\331:\335ste error\223\250\n"
+     "\310put\341o C\200.\2122\346\200\231 relevant\n"
+     " source\204s.\2123:\336view proposed fix.\n"
+     " Press 1\206a\240e\n"
+     "\2232\206d\332.\2124:\324\250s\206verify.\371: \302 if\274\n"
+     "con\251a\207 gets long.\n"},
+    {"Code Review",
+     "\331:\n"
+     "\252/\221\223paste\n"
+     " a\325URL.\2122\346\200\231 all\n"
+     "\301\211the diff.\2123:\n"
+     " Get\372 on:\257 Bug risks\257 Style\235\257 Perform\353\257 Missing \250s\2124:\n"
+     " Ask C\200\206fix\n"
+     "\235 it\326.\n"},
+    {"Git & PRs",
+     "\260workflow\330Make\301 w/ C\200\n"
+     " 2.\252/\215\2463. C\200 wri\322mes\320\n"
+     " 4. A\240e\206\215it\n"
+     "\n"
+     "PR \221:\335ste a PR URL\223use\n"
+     " /pr-\215\277\206f\364\n"
+     " \221\372.\371\217Keep\203\211\366\260\254\376s\n"
+     " C\200\231 git\234\230 better\225\300.\n"},
+};
+
+static const ManualSection advanced_sections[] = {
+    {"Permissions",
+     "C\200 asks \276 us\263\265s \375Bash\223Write\345\202 hier\244y\330\261 .c\200/\201 s\202\226\n"
+     " 2. User ~/.c\200/\201 s\202\226\n"
+     " 3. Defaults\n"
+     "\n"
+     "In s\202\226:\n"
+     " \"allowed\313s\": [...]\n"
+     " \"denied\313s\":  [...]\n"
+     "\n"
+     "/p\224s\206view\n"
+     "\262\210 rules.\n"},
+    {"MCP Servers",
+     "MCP = Model Con\300\n"
+     "Protocol. Connect ex\264al\n"
+     "\265s\206C\200 \350.\n"
+     "\n"
+     "Exa\316\217Data\355 queries\n"
+     "\340\341egra\207s\n"
+     " C\272 data sources\n"
+     "\n"
+     "S\365:\n"
+     " /mcp\206m\374 ser\251\n"
+     " C\256ure\211s\202\n"
+     "\223.c\200/s\202\n"
+     "\n"
+     "MCP ser\251\311as local\n"
+     "processes C\200\307call\n"
+     "\375built-in \265s.\n"},
+    {"Hooks",
+     "Hooks\311\213 \321pts\n"
+     "\276/\254C\200 act\370Type\217Pre\313\275 \276 \265\n"
+     " Post\313\275\254\265\n"
+     "\n"
+     "C\256\211s\202\226:\n"
+     " \"hooks\": {\201\"Pre\313Use\": [{\201  \"\215and\": \"./lint\"\201}]\n"
+     " }\n"
+     "\n"
+     "\275case\217\347-lint on\204 save\324\250s \254ed\246Enforce \245\344ndards\n"},
+    {"Extended Thinking",
+     "C\200\307think deeply\n"
+     "\276\273pon\360.\n"
+     "\n"
+     "When active, C\200 uses\n"
+     "extra\253s reason\263through hard problem\370En\314:\n"
+     "\252\"think\"\211\232\n"
+     "\223toggle via /\214\n"
+     "\n"
+     "Best\230\346o\316x \244ite\255\n"
+     " Multi-step debugg\263 Tricky logic problems\n"
+     "\n"
+     "Uses more\253s but\n"
+     "improves\310put quality.\n"},
+};
+
+static const ManualSection headless_ci_sections[] = {
+    {"Headless Mode",
+     "Run C\200\266out \356\236\200\306\213 \334\n"
+     "\n"
+     "Pipe \270\236at\204 | c\200 -p\201\"\221 this \245\"\n"
+     "\n"
+     "JSON\310put\236\200\306\334\201\243Returns stru\255d\273ult\n"
+     "for \321pting.\n"
+     "\n"
+     "No\341eractive \232s.\n"
+     "No a\240al needed\230\n"
+     "read-only opera\207s.\n"},
+    {"CI Integration",
+     "\275C\200\211CI:\n"
+     "\n"
+     " c\200\306\221 PR\"\201--no-\270\n"
+     "\n"
+     "Key flag\217-p\233\233 print mode\305no-\270 no \232s\305\214\233pick \214\n"
+     " \243Se\220 in\n"
+     "CI environment vari\314\370Exit \245\2170 = success\n"
+     " 1 = error\n"
+     "\n"
+     "Great\230 automated \221\n"
+     "\216\245 g\315\207.\n"},
+    {"Model Selection",
+     "Switch \214s anytime:\n"
+     " /\214\211\356\305\214 flag at launch\n"
+     "\n"
+     "Avail\314 \214s:\n"
+     "\n"
+     " Opus (most cap\314)\n"
+     "  B\363reason\263  High\363\357\n"
+     "\n"
+     " Sonnet (bal\353d)\n"
+     "  Good speed + quality\n"
+     "  Default \214\n"
+     "\n"
+     " Haiku (fas\250)\n"
+     "  Quick\273\377s\n"
+     "  Low\363\357\n"
+     "\n"
+     "Pick \355d on task\n"
+     "co\316xity \216budget.\n"},
+};
+
+static const ManualCategory categories[] = {
+    {"Getting Started", getting_started_sections, 4},
+    {"Workspace", workspace_sections, 5},
+    {"Commands", commands_sections, 6},
+    {"Tools", tools_sections, 3},
+    {"Workflows", workflows_sections, 4},
+    {"Advanced", advanced_sections, 4},
+    {"Headless & CI", headless_ci_sections, 3},
+};
+
+#define CATEGORY_COUNT 7
+
+static const QuizCard quiz_cards[] = {
+    {QuizTypeMultiChoice, "Show help and\navailable commands",
+     "/help", "/help", "/info", "/commands", 0},
+    {QuizTypeMultiChoice, "Clear conversation\nhistory",
+     "/clear", "/reset", "/clear", "/clean", 1},
+    {QuizTypeMultiChoice, "Summarize context to\nreduce token usage",
+     "/compact", "/shrink", "/summarize", "/compact", 2},
+    {QuizTypeMultiChoice, "Open configuration\nsettings editor",
+     "/config", "/config", "/setup", "/preferences", 0},
+    {QuizTypeMultiChoice, "Show token usage\nand session cost",
+     "/cost", "/usage", "/cost", "/tokens", 1},
+    {QuizTypeMultiChoice, "Diagnose setup issues\nand check API",
+     "/doctor", "/debug", "/check", "/doctor", 2},
+    {QuizTypeMultiChoice, "Create CLAUDE.md\nfor your project",
+     "/init", "/init", "/create", "/new", 0},
+    {QuizTypeMultiChoice, "Review PR or\ncode changes",
+     "/review", "/diff", "/review", "/inspect", 1},
+    {QuizTypeMultiChoice, "Fix terminal display\nand rendering",
+     "/terminal-setup", "/fix-term", "/display", "/terminal-setup", 2},
+    {QuizTypeMultiChoice, "Start a brand new\nsession from scratch",
+     "claude --new", "--new", "--fresh", "--reset", 0},
+    {QuizTypeMultiChoice, "Resume your previous\nconversation",
+     "claude --continue", "--resume", "--continue", "--last", 1},
+    {QuizTypeMultiChoice, "Run a one-shot query\nwithout chat mode",
+     "claude -p \"query\"", "-q", "-e", "-p", 2},
+    {QuizTypeMultiChoice, "Switch AI model\nduring a chat session",
+     "/model", "/model", "/switch", "/engine", 0},
+    {QuizTypeMultiChoice, "Edit your project's\nCLAUDE.md memory file",
+     "/memory", "/memo", "/memory", "/notes", 1},
+    {QuizTypeMultiChoice, "Undo to a previous\npoint in conversation",
+     "/rewind", "/back", "/undo", "/rewind", 2},
+    {QuizTypeMultiChoice, "Generate commit msg\nand commit changes",
+     "/commit", "/commit", "/save", "/push", 0},
+    {QuizTypeMultiChoice, "Where do Skills\nfiles live?",
+     ".claude/skills/", ".claude/skills/", "CLAUDE.md", "~/.config/claude/", 0},
+    {QuizTypeMultiChoice, "Which model is the\ndefault for Claude?",
+     "Sonnet", "Opus", "Sonnet", "Haiku", 1},
+    {QuizTypeMultiChoice, "What does the -p\nflag do?",
+     "Print mode (no chat)", "Print mode", "Profile mode", "Plugin mode", 0},
+    {QuizTypeMultiChoice, "Settings hierarchy\nhighest priority?",
+     "Project settings", "Project", "User", "Default", 0},
+    {QuizTypeMultiChoice, "What is MCP?",
+     "Model Context Protocol", "Model Context", "Manual Command", "Memory Cache", 0},
+    {QuizTypeMultiChoice, "Which hook runs\nBEFORE a tool?",
+     "PreToolUse", "PostToolUse", "PreToolUse", "OnToolUse", 1},
+    {QuizTypeMultiChoice, "How to get JSON\noutput from CLI?",
+     "--output-format json", "--json", "--output-format", "--format=json", 1},
+    {QuizTypeMultiChoice, "Ctrl+C in Claude\nCode does what?",
+     "Cancel/interrupt", "Copy text", "Cancel/interrupt", "Clear screen", 1},
+};
+
+#define QUIZ_CARD_COUNT 24
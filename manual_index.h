@@ -0,0 +1,267 @@
+/* Generated by tools/gen_search_index.py from manual/manual.txt. Do not edit. */
+
+#define SEARCH_SECTION_COUNT 29
+#define SEARCH_QUIZ_COUNT 24
+#define SEARCH_TERM_COUNT 482
+
+/* 482 words, 1151 postings, 7606 bytes */
+static const char search_words[] =
+    "18\000about\000access\000across\000actions\000active\000acts\000add\000after\000again\000"
+    "agent\000agents\000ai\000all\000allowed\000allowedtools\000alternative\000always\000"
+    "analyze\000analyzes\000answer\000ant\000anthropic\000any\000anytime\000api\000approval\000"
+    "approve\000architecture\000ask\000asks\000auth\000authenticate\000authentication\000auto\000"
+    "autocomplete\000automated\000automatically\000available\000balanced\000based\000bash\000"
+    "basics\000before\000best\000better\000big\000brand\000brew\000broken\000browser\000budget\000"
+    "bug\000build\000builds\000built\000but\000call\000can\000cancel\000capable\000cases\000"
+    "cat\000cells\000changes\000chat\000check\000ci\000claude\000clear\000cli\000code\000"
+    "codebase\000codes\000coding\000command\000commands\000comments\000commit\000common\000"
+    "compact\000complex\000complexity\000config\000configuration\000configure\000connect\000"
+    "connection\000contents\000context\000continue\000conventions\000conversation\000cost\000"
+    "create\000creates\000ctrl\000current\000custom\000dark\000data\000database\000debug\000"
+    "debugging\000decline\000deeply\000default\000defaults\000denied\000deniedtools\000"
+    "describe\000description\000details\000diagnose\000dictation\000diff\000dir\000directory\000"
+    "display\000do\000doctor\000does\000domain\000down\000during\000each\000edit\000editor\000"
+    "enable\000enforce\000enter\000environment\000error\000esc\000estimated\000every\000"
+    "examples\000existing\000exists\000exit\000explore\000export\000extended\000external\000"
+    "extra\000fastest\000feedback\000fetch\000file\000files\000filter\000find\000first\000fix\000"
+    "flag\000flags\000flat\000format\000found\000fresh\000full\000general\000generate\000"
+    "generates\000generation\000get\000gets\000git\000github\000glob\000good\000great\000grep\000"
+    "guide\000haiku\000hard\000headless\000help\000hierarchy\000highest\000history\000hook\000"
+    "hooks\000how\000ideal\000images\000implementations\000improves\000includes\000"
+    "independently\000info\000init\000input\000install\000installed\000installing\000"
+    "instructions\000integration\000integrations\000interactive\000internet\000interrupt\000"
+    "into\000issues\000js\000json\000jupyter\000keep\000key\000keybindings\000knowledge\000"
+    "last\000later\000launch\000layout\000let\000light\000like\000lint\000linux\000listen\000"
+    "live\000loads\000local\000location\000locations\000log\000logic\000login\000logout\000"
+    "long\000lowest\000macos\000major\000make\000manage\000management\000matching\000max\000"
+    "mcp\000md\000memory\000message\000mid\000milestone\000milestones\000missing\000mode\000"
+    "model\000models\000modify\000monthly\000more\000most\000msg\000multi\000name\000"
+    "navigation\000need\000needed\000new\000no\000node\000not\000notebookedit\000notebooks\000"
+    "notes\000notification\000npm\000old\000one\000only\000open\000opens\000operation\000"
+    "operations\000opus\000other\000out\000output\000overwrites\000own\000package\000paste\000"
+    "pasting\000paths\000pattern\000patterns\000pause\000pay\000pdfs\000per\000performance\000"
+    "permission\000permissions\000persist\000pick\000pipe\000place\000plan\000platforms\000"
+    "point\000posttooluse\000pr\000preserves\000press\000pretooluse\000previous\000print\000"
+    "priority\000problems\000processes\000project\000projects\000prompt\000prompts\000proposed\000"
+    "protocol\000prs\000purpose\000quality\000queries\000query\000quick\000quickly\000rate\000"
+    "rather\000read\000reads\000reasoning\000recommended\000reduce\000reduces\000regex\000"
+    "relevant\000remove\000rendering\000repeat\000replace\000repo\000report\000request\000"
+    "required\000requirements\000requires\000responding\000response\000responses\000result\000"
+    "results\000resume\000return\000returns\000reusable\000revert\000review\000rewind\000risks\000"
+    "root\000rules\000run\000runs\000same\000save\000scratch\000scripting\000scripts\000"
+    "scrolling\000search\000see\000selection\000servers\000session\000sessions\000set\000"
+    "settings\000setup\000share\000shell\000shortcuts\000shot\000show\000sign\000size\000sk\000"
+    "skill\000skills\000slash\000slow\000so\000sonnet\000sounds\000source\000sources\000"
+    "specific\000speed\000src\000stack\000standards\000start\000starting\000starts\000state\000"
+    "status\000step\000stored\000stores\000structure\000structured\000style\000sub\000"
+    "subscription\000success\000summarize\000supported\000supports\000switch\000system\000tab\000"
+    "task\000team\000tech\000tell\000templates\000terminal\000test\000tests\000text\000than\000"
+    "them\000theme\000think\000thinking\000this\000through\000tip\000tips\000toggle\000token\000"
+    "tokens\000tool\000tools\000tricky\000ts\000two\000type\000types\000undo\000up\000url\000"
+    "urls\000usage\000use\000used\000user\000uses\000using\000utf\000variables\000verify\000"
+    "via\000view\000vim\000voice\000wait\000want\000ways\000web\000webfetch\000websearch\000"
+    "what\000when\000where\000which\000wipe\000without\000workflow\000workflows\000write\000"
+    "writes\000wsl\000yes\000";
+
+static const SearchTerm search_terms[SEARCH_TERM_COUNT + 1] = {
+    {0, 0}, {3, 2}, {9, 3}, {16, 4}, {23, 5}, {31, 6},
+    {38, 7}, {43, 8}, {47, 10}, {53, 15}, {59, 16}, {65, 17},
+    {72, 20}, {75, 23}, {79, 25}, {87, 26}, {100, 27}, {112, 28},
+    {119, 29}, {127, 30}, {136, 31}, {143, 32}, {147, 34}, {157, 40},
+    {161, 41}, {169, 42}, {173, 53}, {182, 55}, {190, 60}, {203, 63},
+    {207, 64}, {212, 65}, {217, 67}, {230, 68}, {245, 69}, {250, 72},
+    {263, 73}, {273, 74}, {287, 76}, {297, 78}, {306, 79}, {312, 80},
+    {317, 83}, {324, 84}, {331, 89}, {336, 92}, {343, 93}, {347, 94},
+    {353, 95}, {358, 98}, {365, 99}, {373, 100}, {380, 101}, {384, 104},
+    {390, 106}, {397, 107}, {403, 108}, {407, 109}, {412, 110}, {416, 115},
+    {423, 118}, {431, 119}, {437, 120}, {441, 121}, {447, 122}, {455, 127},
+    {460, 134}, {466, 138}, {469, 140}, {476, 210}, {482, 212}, {486, 213},
+    {491, 225}, {500, 227}, {506, 228}, {513, 230}, {521, 232}, {530, 239},
+    {539, 242}, {546, 252}, {553, 253}, {561, 257}, {569, 258}, {580, 259},
+    {587, 265}, {601, 267}, {611, 268}, {619, 269}, {630, 270}, {639, 272},
+    {647, 279}, {656, 282}, {668, 283}, {681, 291}, {686, 296}, {693, 298},
+    {701, 300}, {706, 303}, {714, 307}, {721, 312}, {726, 313}, {731, 314},
+    {740, 315}, {746, 316}, {756, 318}, {764, 321}, {771, 322}, {779, 324},
+    {788, 325}, {795, 326}, {807, 327}, {816, 328}, {828, 329}, {836, 330},
+    {845, 332}, {855, 333}, {860, 334}, {864, 336}, {874, 340}, {882, 343},
+    {885, 345}, {892, 347}, {897, 349}, {904, 350}, {909, 352}, {916, 353},
+    {921, 355}, {926, 362}, {933, 365}, {940, 366}, {948, 367}, {954, 368},
+    {966, 369}, {972, 371}, {976, 372}, {986, 373}, {992, 374}, {1001, 375},
+    {1010, 376}, {1017, 377}, {1022, 379}, {1030, 382}, {1037, 385}, {1046, 386},
+    {1055, 387}, {1061, 388}, {1069, 389}, {1078, 391}, {1084, 394}, {1089, 407},
+    {1095, 414}, {1102, 415}, {1107, 418}, {1113, 419}, {1117, 423}, {1122, 425},
+    {1128, 426}, {1133, 427}, {1140, 430}, {1146, 433}, {1152, 436}, {1157, 437},
+    {1165, 438}, {1174, 440}, {1184, 441}, {1195, 442}, {1199, 445}, {1204, 446},
+    {1208, 453}, {1215, 455}, {1220, 456}, {1225, 457}, {1231, 458}, {1236, 459},
+    {1242, 460}, {1248, 462}, {1253, 463}, {1262, 464}, {1267, 465}, {1277, 467},
+    {1285, 469}, {1293, 474}, {1298, 475}, {1304, 477}, {1308, 478}, {1314, 479},
+    {1321, 480}, {1337, 481}, {1346, 482}, {1355, 483}, {1369, 484}, {1374, 486},
+    {1379, 490}, {1385, 495}, {1393, 497}, {1403, 498}, {1414, 499}, {1427, 500},
+    {1439, 501}, {1452, 502}, {1464, 503}, {1473, 504}, {1483, 506}, {1488, 508},
+    {1495, 514}, {1498, 516}, {1503, 528}, {1511, 529}, {1516, 531}, {1520, 545},
+    {1532, 546}, {1542, 547}, {1547, 548}, {1553, 549}, {1560, 552}, {1567, 553},
+    {1571, 554}, {1577, 555}, {1582, 558}, {1587, 560}, {1593, 561}, {1600, 562},
+    {1605, 563}, {1611, 565}, {1617, 566}, {1626, 567}, {1636, 568}, {1640, 569},
+    {1646, 570}, {1652, 575}, {1659, 577}, {1664, 578}, {1671, 579}, {1677, 581},
+    {1683, 582}, {1688, 583}, {1695, 586}, {1706, 587}, {1715, 589}, {1719, 591},
+    {1723, 597}, {1726, 611}, {1733, 613}, {1741, 615}, {1745, 616}, {1755, 617},
+    {1766, 618}, {1774, 619}, {1779, 624}, {1785, 639}, {1792, 641}, {1799, 642},
+    {1807, 643}, {1812, 644}, {1817, 645}, {1821, 646}, {1827, 647}, {1832, 648},
+    {1843, 649}, {1848, 650}, {1855, 651}, {1859, 657}, {1862, 665}, {1867, 667},
+    {1871, 668}, {1884, 669}, {1894, 670}, {1900, 671}, {1913, 672}, {1917, 676},
+    {1921, 677}, {1925, 678}, {1930, 679}, {1935, 683}, {1941, 684}, {1951, 685},
+    {1962, 687}, {1967, 689}, {1973, 690}, {1977, 692}, {1984, 698}, {1995, 699},
+    {1999, 700}, {2007, 701}, {2013, 704}, {2021, 705}, {2027, 706}, {2035, 708},
+    {2044, 710}, {2050, 711}, {2054, 712}, {2059, 713}, {2063, 714}, {2075, 715},
+    {2086, 716}, {2098, 721}, {2106, 722}, {2111, 724}, {2116, 725}, {2122, 726},
+    {2127, 727}, {2137, 728}, {2143, 730}, {2155, 731}, {2158, 739}, {2168, 740},
+    {2174, 742}, {2185, 745}, {2194, 748}, {2200, 751}, {2209, 752}, {2218, 754},
+    {2228, 755}, {2236, 774}, {2245, 775}, {2252, 777}, {2260, 781}, {2269, 782},
+    {2278, 784}, {2282, 785}, {2290, 786}, {2298, 788}, {2306, 789}, {2312, 793},
+    {2318, 794}, {2326, 795}, {2331, 796}, {2338, 797}, {2343, 799}, {2349, 806},
+    {2359, 808}, {2371, 810}, {2378, 812}, {2386, 813}, {2392, 814}, {2401, 815},
+    {2408, 816}, {2418, 818}, {2425, 819}, {2433, 822}, {2438, 824}, {2445, 825},
+    {2453, 826}, {2462, 827}, {2475, 829}, {2484, 830}, {2495, 831}, {2504, 832},
+    {2514, 834}, {2521, 835}, {2529, 837}, {2536, 841}, {2543, 842}, {2551, 843},
+    {2560, 844}, {2567, 845}, {2574, 856}, {2581, 858}, {2587, 859}, {2592, 862},
+    {2598, 865}, {2602, 874}, {2607, 875}, {2612, 876}, {2617, 877}, {2625, 878},
+    {2635, 879}, {2643, 880}, {2653, 881}, {2660, 886}, {2664, 888}, {2674, 890},
+    {2682, 894}, {2690, 906}, {2699, 908}, {2703, 911}, {2712, 926}, {2718, 934},
+    {2724, 935}, {2730, 936}, {2740, 937}, {2745, 938}, {2750, 942}, {2755, 947},
+    {2760, 948}, {2763, 950}, {2769, 953}, {2776, 959}, {2782, 962}, {2787, 963},
+    {2790, 964}, {2797, 967}, {2804, 968}, {2811, 969}, {2819, 970}, {2828, 971},
+    {2834, 972}, {2838, 973}, {2844, 975}, {2854, 976}, {2860, 984}, {2869, 985},
+    {2876, 986}, {2882, 987}, {2889, 989}, {2894, 1002}, {2901, 1003}, {2908, 1005},
+    {2918, 1007}, {2929, 1008}, {2935, 1009}, {2939, 1011}, {2952, 1012}, {2960, 1013},
+    {2970, 1015}, {2980, 1016}, {2989, 1017}, {2996, 1020}, {3003, 1022}, {3007, 1023},
+    {3012, 1026}, {3017, 1027}, {3022, 1029}, {3027, 1030}, {3037, 1031}, {3046, 1037},
+    {3051, 1040}, {3057, 1045}, {3062, 1046}, {3067, 1047}, {3072, 1048}, {3078, 1050},
+    {3084, 1052}, {3093, 1053}, {3098, 1055}, {3106, 1056}, {3110, 1058}, {3115, 1059},
+    {3122, 1061}, {3128, 1066}, {3135, 1068}, {3140, 1072}, {3146, 1076}, {3153, 1077},
+    {3156, 1078}, {3160, 1079}, {3165, 1087}, {3171, 1088}, {3176, 1090}, {3179, 1091},
+    {3183, 1093}, {3188, 1094}, {3194, 1099}, {3198, 1106}, {3203, 1107}, {3208, 1108},
+    {3213, 1110}, {3219, 1111}, {3223, 1112}, {3233, 1113}, {3240, 1115}, {3244, 1118},
+    {3249, 1121}, {3253, 1123}, {3259, 1124}, {3264, 1125}, {3269, 1126}, {3274, 1127},
+    {3278, 1128}, {3287, 1129}, {3297, 1130}, {3302, 1134}, {3307, 1138}, {3313, 1139},
+    {3319, 1141}, {3324, 1142}, {3332, 1144}, {3341, 1145}, {3351, 1146}, {3357, 1148},
+    {3364, 1149}, {3368, 1150}, {3372, 1151},
+};
+
+static const uint16_t search_postings[] = {
+    0x0007, 0x0204, 0x1209, 0x0E02, 0x100B, 0x120D, 0x1903, 0x1801, 0x0611, 0x0F0F,
+    0x1210, 0x150D, 0x1801, 0x1805, 0x1810, 0x030B, 0x100A, 0x1100, 0x1101, 0x1110,
+    0x0001, 0x0D15, 0x2900, 0x0105, 0x1405, 0x070A, 0x160B, 0x0909, 0x040B, 0x110A,
+    0x0607, 0x100D, 0x000C, 0x0308, 0x0001, 0x0008, 0x000B, 0x0307, 0x0D0C, 0x1B0B,
+    0x0100, 0x1C00, 0x0008, 0x000B, 0x020D, 0x0306, 0x0307, 0x0310, 0x0C02, 0x0C07,
+    0x1706, 0x1B0B, 0x2200, 0x0906, 0x1A0F, 0x0907, 0x0B0A, 0x120D, 0x130A, 0x1504,
+    0x0506, 0x100D, 0x190C, 0x1410, 0x1600, 0x030D, 0x0E0D, 0x0300, 0x0300, 0x0B0A,
+    0x0D04, 0x180F, 0x0904, 0x1B12, 0x0501, 0x0801, 0x1C04, 0x1D00, 0x1C0A, 0x1C12,
+    0x1102, 0x1105, 0x1601, 0x0900, 0x1600, 0x1801, 0x1804, 0x1901, 0x3200, 0x0400,
+    0x190B, 0x1C07, 0x150F, 0x0A07, 0x2600, 0x0004, 0x0005, 0x0205, 0x0C11, 0x0304,
+    0x1C13, 0x0D00, 0x0D01, 0x140A, 0x0508, 0x060E, 0x1107, 0x1710, 0x1910, 0x170F,
+    0x0401, 0x040F, 0x0410, 0x170F, 0x1900, 0x0901, 0x0903, 0x3400, 0x1C06, 0x180E,
+    0x1A04, 0x0F0F, 0x0D09, 0x1406, 0x1501, 0x2400, 0x2C00, 0x010D, 0x0D15, 0x1A00,
+    0x1C01, 0x2800, 0x2900, 0x2F00, 0x030D, 0x0C02, 0x0C0B, 0x2200, 0x1B00, 0x1B0C,
+    0x0000, 0x0002, 0x0005, 0x000F, 0x0101, 0x0103, 0x0108, 0x010B, 0x010E, 0x020B,
+    0x020D, 0x0302, 0x0303, 0x0400, 0x0405, 0x0406, 0x040B, 0x040F, 0x0500, 0x0504,
+    0x050B, 0x0600, 0x0604, 0x0607, 0x0609, 0x0700, 0x0704, 0x070F, 0x0711, 0x0801,
+    0x0804, 0x0807, 0x0808, 0x0902, 0x0B0F, 0x0D01, 0x0D12, 0x100F, 0x1201, 0x1205,
+    0x1302, 0x1305, 0x1405, 0x1410, 0x1501, 0x1503, 0x150E, 0x1600, 0x1604, 0x1606,
+    0x1702, 0x170C, 0x170F, 0x1801, 0x1900, 0x1903, 0x1A00, 0x1A01, 0x1A04, 0x1A08,
+    0x1B00, 0x1B02, 0x2300, 0x2600, 0x2700, 0x2800, 0x2A00, 0x2D00, 0x2E00, 0x3400,
+    0x0A00, 0x1E00, 0x3300, 0x0002, 0x0005, 0x080C, 0x0902, 0x0D01, 0x1400, 0x1702,
+    0x1811, 0x1A05, 0x1B13, 0x2400, 0x3400, 0x0608, 0x100B, 0x1B0E, 0x0507, 0x060F,
+    0x0600, 0x180A, 0x0508, 0x060E, 0x0811, 0x0D00, 0x0E00, 0x1106, 0x1D00, 0x0E04,
+    0x0E06, 0x1508, 0x0711, 0x0D03, 0x0D04, 0x0D05, 0x1210, 0x1500, 0x1502, 0x1504,
+    0x150D, 0x2C00, 0x0C05, 0x0A04, 0x0C0E, 0x1310, 0x1F00, 0x190C, 0x1C13, 0x0712,
+    0x0B00, 0x0B0F, 0x0C0B, 0x1807, 0x2000, 0x0B00, 0x2000, 0x170B, 0x1701, 0x0C02,
+    0x0F01, 0x1001, 0x050D, 0x0A07, 0x0F0B, 0x150F, 0x1700, 0x1F00, 0x3100, 0x010B,
+    0x0A0F, 0x2700, 0x0507, 0x0A01, 0x0A05, 0x0C0F, 0x0E0A, 0x1311, 0x1E00, 0x2700,
+    0x2B00, 0x0A09, 0x0A0B, 0x1C08, 0x1C10, 0x2100, 0x0F05, 0x2300, 0x0600, 0x1205,
+    0x0901, 0x0902, 0x3400, 0x0104, 0x0A0C, 0x110E, 0x160F, 0x0707, 0x070E, 0x080B,
+    0x0811, 0x1707, 0x0B0B, 0x1707, 0x1705, 0x1300, 0x0C00, 0x190D, 0x0908, 0x120E,
+    0x130B, 0x1900, 0x1C0C, 0x2E00, 0x1608, 0x0C0A, 0x160C, 0x1208, 0x0505, 0x060C,
+    0x0C01, 0x2200, 0x090F, 0x1406, 0x040C, 0x0A02, 0x0104, 0x0502, 0x0605, 0x0700,
+    0x0B06, 0x0C11, 0x2500, 0x2D00, 0x2F00, 0x0C00, 0x2200, 0x2F00, 0x3400, 0x080E,
+    0x090C, 0x090F, 0x2900, 0x0806, 0x1210, 0x0611, 0x0D12, 0x0E01, 0x0F08, 0x0F0E,
+    0x1810, 0x2A00, 0x0B01, 0x0E12, 0x2000, 0x1907, 0x1811, 0x0111, 0x1B0C, 0x1301,
+    0x1B10, 0x0903, 0x0A0B, 0x050C, 0x1704, 0x0F09, 0x0F06, 0x0902, 0x1B0E, 0x1000,
+    0x100A, 0x1102, 0x000B, 0x0307, 0x0C08, 0x1900, 0x1701, 0x1904, 0x1C0E, 0x1409,
+    0x1509, 0x0E05, 0x110A, 0x1508, 0x0500, 0x0509, 0x060B, 0x0806, 0x0D09, 0x0F00,
+    0x0F01, 0x1001, 0x1003, 0x1010, 0x180F, 0x1A04, 0x2A00, 0x0105, 0x070E, 0x0F05,
+    0x0F09, 0x1006, 0x1306, 0x2D00, 0x1003, 0x0F0A, 0x1006, 0x100C, 0x0100, 0x0B05,
+    0x1309, 0x1410, 0x2500, 0x1C02, 0x2F00, 0x1B05, 0x030F, 0x1A09, 0x1B09, 0x3300,
+    0x060F, 0x0C07, 0x1411, 0x0107, 0x0A02, 0x0A10, 0x0401, 0x1103, 0x0D04, 0x2C00,
+    0x0609, 0x1B13, 0x110E, 0x1409, 0x3300, 0x1311, 0x0209, 0x020A, 0x040E, 0x1107,
+    0x1500, 0x150C, 0x150E, 0x0E05, 0x1402, 0x1005, 0x1C0B, 0x1B12, 0x1000, 0x0500,
+    0x0D16, 0x1C0E, 0x1905, 0x1A00, 0x1D00, 0x1603, 0x3000, 0x1C08, 0x3000, 0x040F,
+    0x090C, 0x0A01, 0x150E, 0x1E00, 0x3200, 0x1800, 0x1808, 0x3300, 0x0400, 0x0F02,
+    0x100C, 0x1911, 0x060B, 0x1110, 0x0E0E, 0x110E, 0x0600, 0x0606, 0x1204, 0x2300,
+    0x0903, 0x0E12, 0x1A03, 0x1B03, 0x1B07, 0x0000, 0x0005, 0x0209, 0x0000, 0x0612,
+    0x1B00, 0x1706, 0x1A0E, 0x110D, 0x0901, 0x3400, 0x0E06, 0x1302, 0x0B06, 0x0C01,
+    0x0C05, 0x140B, 0x1411, 0x2200, 0x0007, 0x0204, 0x0409, 0x0705, 0x0709, 0x0B0F,
+    0x1605, 0x1607, 0x160A, 0x1807, 0x1A07, 0x1A09, 0x1B09, 0x3300, 0x0F0E, 0x040E,
+    0x150C, 0x0008, 0x000A, 0x000B, 0x020D, 0x0306, 0x0307, 0x0509, 0x0900, 0x0B02,
+    0x0B08, 0x0C07, 0x0C08, 0x1B05, 0x1B0B, 0x0E11, 0x080E, 0x010A, 0x0204, 0x0100,
+    0x1101, 0x1C02, 0x0403, 0x100F, 0x0B0B, 0x0808, 0x1601, 0x1710, 0x180A, 0x180F,
+    0x0201, 0x0D07, 0x2D00, 0x070F, 0x0801, 0x170E, 0x0803, 0x0509, 0x000E, 0x190E,
+    0x000F, 0x020D, 0x0303, 0x030B, 0x0D0B, 0x030C, 0x0D0E, 0x1311, 0x1C10, 0x0201,
+    0x090E, 0x1211, 0x1501, 0x030A, 0x0D19, 0x170A, 0x0A00, 0x1002, 0x1007, 0x0302,
+    0x030F, 0x0D18, 0x0D19, 0x1700, 0x170A, 0x170E, 0x3100, 0x020B, 0x0405, 0x0500,
+    0x050B, 0x0600, 0x0609, 0x0707, 0x0804, 0x0806, 0x0808, 0x0D12, 0x1205, 0x2300,
+    0x2A00, 0x0D11, 0x2A00, 0x0D05, 0x1503, 0x0D15, 0x1211, 0x150D, 0x140D, 0x010D,
+    0x1A00, 0x1B06, 0x2800, 0x2F00, 0x0B02, 0x0B09, 0x0D14, 0x0D15, 0x0E0D, 0x1700,
+    0x1909, 0x1B08, 0x1C00, 0x1C01, 0x1C02, 0x1C0C, 0x2900, 0x2E00, 0x3100, 0x1C00,
+    0x1C04, 0x0F09, 0x030F, 0x1910, 0x1C06, 0x2C00, 0x190D, 0x1006, 0x0900, 0x050D,
+    0x1A0F, 0x0108, 0x0A10, 0x0F05, 0x1200, 0x1201, 0x2600, 0x010D, 0x050C, 0x0908,
+    0x1A0E, 0x1A0F, 0x1B03, 0x1B07, 0x2F00, 0x0007, 0x0204, 0x0C07, 0x0F0D, 0x0F0E,
+    0x0506, 0x0B0C, 0x0000, 0x0001, 0x0205, 0x1107, 0x0810, 0x2800, 0x1A10, 0x0100,
+    0x0604, 0x0B01, 0x2000, 0x0304, 0x020E, 0x0F00, 0x1A10, 0x0D16, 0x1C06, 0x0909,
+    0x030C, 0x0D0F, 0x1302, 0x1911, 0x1A07, 0x1A09, 0x1B09, 0x3300, 0x0F06, 0x0611,
+    0x0409, 0x1301, 0x1401, 0x1507, 0x1010, 0x1010, 0x1002, 0x1007, 0x060F, 0x0B0A,
+    0x0D08, 0x0310, 0x0F02, 0x0310, 0x140C, 0x0C0A, 0x070B, 0x0C03, 0x0E00, 0x1600,
+    0x160E, 0x0A0E, 0x1B08, 0x1C12, 0x1A03, 0x050F, 0x1102, 0x0200, 0x0E0A, 0x2B00,
+    0x1805, 0x0E04, 0x0E05, 0x1402, 0x1506, 0x1507, 0x1508, 0x1B02, 0x2400, 0x0F0B,
+    0x0111, 0x130A, 0x1804, 0x1809, 0x3200, 0x0E09, 0x2700, 0x2B00, 0x010D, 0x1B06,
+    0x2F00, 0x3000, 0x1905, 0x190E, 0x170F, 0x0105, 0x020A, 0x020B, 0x0400, 0x0401,
+    0x0404, 0x040C, 0x0505, 0x050F, 0x0601, 0x0605, 0x060D, 0x0701, 0x1200, 0x150C,
+    0x1604, 0x2300, 0x2A00, 0x3000, 0x040E, 0x0111, 0x1908, 0x0800, 0x0906, 0x1A0E,
+    0x1B07, 0x1309, 0x1701, 0x3100, 0x1500, 0x1103, 0x1911, 0x1C0B, 0x1705, 0x010E,
+    0x1A01, 0x1A08, 0x2800, 0x1C0F, 0x0D12, 0x030F, 0x100F, 0x0F00, 0x1A10, 0x0104,
+    0x0501, 0x050B, 0x0807, 0x1305, 0x1405, 0x150E, 0x1904, 0x1C07, 0x0208, 0x0403,
+    0x0C0E, 0x1F00, 0x0A06, 0x1002, 0x1305, 0x0F0F, 0x0B05, 0x2500, 0x050D, 0x0810,
+    0x0F0A, 0x0F0F, 0x020A, 0x150C, 0x0D01, 0x0110, 0x020E, 0x0200, 0x0203, 0x0007,
+    0x1901, 0x080D, 0x0C0D, 0x1C0F, 0x1A0B, 0x0400, 0x1111, 0x010A, 0x0A0F, 0x0D09,
+    0x2700, 0x1111, 0x1A0B, 0x0800, 0x0410, 0x080C, 0x0E05, 0x1309, 0x1400, 0x1401,
+    0x1506, 0x1509, 0x1A05, 0x1B02, 0x1B12, 0x2400, 0x0E08, 0x2B00, 0x140A, 0x020B,
+    0x040C, 0x050F, 0x0612, 0x080C, 0x160F, 0x040B, 0x1106, 0x1110, 0x130E, 0x170E,
+    0x1800, 0x1810, 0x1A00, 0x2800, 0x3200, 0x0A02, 0x180F, 0x2600, 0x1A0C, 0x1800,
+    0x090B, 0x1000, 0x1001, 0x100B, 0x100F, 0x110D, 0x0401, 0x040F, 0x0B09, 0x1C00,
+    0x0D19, 0x1700, 0x170A, 0x170E, 0x010A, 0x050C, 0x0A00, 0x0A0C, 0x0D0F, 0x0E02,
+    0x0E06, 0x0E0E, 0x160F, 0x2100, 0x2600, 0x2900, 0x030A, 0x0A0E, 0x000A, 0x0B02,
+    0x1B0B, 0x0701, 0x0705, 0x0709, 0x0B01, 0x0B08, 0x0B0E, 0x1603, 0x1605, 0x1607,
+    0x160A, 0x170B, 0x170C, 0x1807, 0x2000, 0x3000, 0x0400, 0x0B04, 0x0C01, 0x0C12,
+    0x1200, 0x1709, 0x2200, 0x2500, 0x0711, 0x1106, 0x0900, 0x2800, 0x0A0A, 0x0E0D,
+    0x1D00, 0x2100, 0x0304, 0x030B, 0x030C, 0x0D0C, 0x0D0F, 0x0C0F, 0x000C, 0x0308,
+    0x0707, 0x070E, 0x0806, 0x0706, 0x070D, 0x0800, 0x0804, 0x0810, 0x2D00, 0x0811,
+    0x0D00, 0x0E00, 0x0C0D, 0x040E, 0x0D16, 0x1C0A, 0x2E00, 0x0B0C, 0x1306, 0x1707,
+    0x1209, 0x1C0B, 0x0407, 0x060C, 0x120A, 0x1811, 0x0107, 0x050C, 0x070F, 0x0807,
+    0x090F, 0x0A02, 0x0A10, 0x2600, 0x0502, 0x0103, 0x030D, 0x030D, 0x0E0C, 0x1200,
+    0x1203, 0x1207, 0x120C, 0x1300, 0x1304, 0x1308, 0x130D, 0x1400, 0x1404, 0x1408,
+    0x140F, 0x190D, 0x0B0E, 0x0701, 0x070A, 0x060D, 0x0703, 0x1A0B, 0x140B, 0x1100,
+    0x1101, 0x0302, 0x1B0F, 0x0A05, 0x1F00, 0x0200, 0x0F02, 0x0D15, 0x1C00, 0x2900,
+    0x0200, 0x0800, 0x0904, 0x100A, 0x1100, 0x1C12, 0x0712, 0x060C, 0x120A, 0x0504,
+    0x080D, 0x0100, 0x0206, 0x0B04, 0x0B05, 0x0C12, 0x2500, 0x0508, 0x1300, 0x1301,
+    0x0408, 0x1107, 0x130E, 0x140D, 0x1810, 0x0F0A, 0x1010, 0x0807, 0x0B02, 0x0B0B,
+    0x1900, 0x1908, 0x1900, 0x0E02, 0x1A05, 0x1905, 0x1210, 0x1310, 0x150B, 0x0E11,
+    0x1909, 0x0310, 0x0A06, 0x0A0A, 0x1F00, 0x2100, 0x1904, 0x1910, 0x0E01, 0x1804,
+    0x1805, 0x3200, 0x070A, 0x1601, 0x1702, 0x1710, 0x190E, 0x1008, 0x0300, 0x0100,
+    0x0110, 0x0606, 0x1003, 0x1204, 0x1401, 0x1502, 0x1908, 0x1803, 0x0E09, 0x2B00,
+    0x090C, 0x1402, 0x1507, 0x110A, 0x0603, 0x0A06, 0x0A0A, 0x1F00, 0x2100, 0x0504,
+    0x080A, 0x0A07, 0x0A0E, 0x1507, 0x180E, 0x1B00, 0x0310, 0x1606, 0x1903, 0x1910,
+    0x1600, 0x0206, 0x1B0C, 0x0C03, 0x130E, 0x0000, 0x0004, 0x1909, 0x0E01, 0x0F01,
+    0x160E, 0x0E10, 0x0E11, 0x090E, 0x0D08, 0x1208, 0x0300, 0x1100, 0x1109, 0x110C,
+    0x1208, 0x2F00, 0x3100, 0x3400, 0x0400, 0x0501, 0x0A07, 0x1903, 0x2D00, 0x2E00,
+    0x3200, 0x0A01, 0x1A00, 0x2800, 0x1500, 0x080B, 0x0F04, 0x1601, 0x1503, 0x0201,
+    0x0907,
+};
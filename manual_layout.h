@@ -0,0 +1,276 @@
+/* Generated by tools/gen_manual_layout.py from manual/manual.txt. Do not edit. */
+/* wrapped with FontSecondary (u8g2_font_haxrcorp4089_tr) glyph advances; dense view with u8g2_font_4x6_tr, 4 px per glyph */
+
+#define LAYOUT_SECTION_COUNT 29
+#define LAYOUT_QUIZ_COUNT 24
+#define LAYOUT_FRAGMENT_COUNT 128
+
+/* 546 reader lines, 544 dense, 43 quiz lines */
+static const LayoutLine manual_lines[] = {
+    {0, 16, 0}, {9, 23, 1}, {24, 11, 3}, {29, 0, 0}, {30, 12, 0}, {44, 24, 1},
+    {56, 0, 0}, {56, 27, 0}, {71, 18, 0}, {75, 0, 0}, {75, 13, 0}, {84, 6, 1},
+    {89, 17, 1}, {91, 11, 3}, {91, 0, 0}, {92, 15, 0}, {103, 12, 1}, {108, 0, 0},
+    {0, 27, 0}, {14, 6, 1}, {17, 0, 0}, {18, 21, 0}, {27, 27, 0}, {35, 26, 0},
+    {43, 0, 0}, {43, 12, 0}, {46, 12, 1}, {54, 0, 0}, {54, 20, 0}, {65, 17, 1},
+    {79, 0, 0}, {80, 21, 0}, {97, 22, 1}, {104, 0, 0}, {105, 24, 0}, {121, 25, 0},
+    {139, 0, 0}, {0, 20, 0}, {16, 17, 1}, {33, 0, 0}, {33, 13, 0}, {44, 19, 1},
+    {52, 11, 1}, {60, 19, 1}, {69, 0, 0}, {69, 12, 0}, {76, 13, 1}, {86, 21, 1},
+    {91, 25, 1}, {98, 0, 0}, {99, 23, 0}, {109, 23, 0}, {127, 0, 0}, {0, 25, 0},
+    {23, 0, 0}, {24, 26, 0}, {41, 12, 3}, {46, 24, 3}, {65, 0, 0}, {66, 10, 0},
+    {71, 6, 3}, {76, 17, 3}, {80, 11, 5}, {80, 0, 0}, {81, 16, 0}, {85, 22, 1},
+    {102, 17, 1}, {118, 25, 1}, {141, 0, 0}, {142, 23, 0}, {166, 24, 0}, {186, 0, 0},
+    {0, 24, 0}, {18, 26, 0}, {34, 0, 0}, {34, 19, 0}, {47, 8, 1}, {50, 9, 3},
+    {52, 8, 3}, {57, 4, 3}, {62, 6, 3}, {66, 12, 3}, {75, 0, 0}, {76, 27, 0},
+    {92, 17, 0}, {100, 0, 0}, {101, 23, 0}, {115, 26, 0}, {123, 15, 0}, {135, 0, 0},
+    {0, 26, 0}, {11, 24, 0}, {20, 24, 0}, {30, 0, 0}, {31, 22, 0}, {43, 21, 1},
+    {51, 20, 1}, {66, 20, 1}, {76, 21, 1}, {87, 20, 1}, {100, 0, 0}, {101, 25, 0},
+    {110, 23, 0}, {124, 23, 0}, {139, 0, 0}, {140, 25, 0}, {155, 0, 0}, {0, 25, 0},
+    {15, 17, 0}, {23, 0, 0}, {24, 6, 0}, {26, 22, 1}, {34, 17, 4}, {38, 13, 1},
+    {45, 23, 1}, {63, 8, 4}, {67, 24, 1}, {77, 0, 0}, {78, 18, 0}, {91, 20, 1},
+    {108, 19, 1}, {116, 16, 1}, {125, 23, 1}, {134, 0, 0}, {135, 23, 0}, {150, 22, 0},
+    {167, 0, 0}, {0, 22, 0}, {10, 24, 0}, {20, 0, 0}, {20, 10, 0}, {28, 8, 1},
+    {33, 13, 3}, {37, 7, 3}, {44, 15, 5}, {53, 0, 0}, {54, 14, 0}, {60, 20, 1},
+    {79, 16, 1}, {82, 0, 0}, {83, 8, 0}, {87, 18, 1}, {96, 22, 1}, {112, 0, 0},
+    {113, 24, 0}, {125, 22, 0}, {137, 0, 0}, {0, 27, 0}, {17, 27, 0}, {25, 0, 0},
+    {26, 9, 0}, {34, 19, 1}, {47, 0, 0}, {48, 25, 0}, {67, 26, 0}, {79, 15, 0},
+    {83, 0, 0}, {84, 8, 0}, {89, 18, 1}, {102, 19, 1}, {112, 20, 1}, {127, 18, 1},
+    {145, 0, 0}, {146, 29, 0}, {160, 15, 0}, {170, 0, 0}, {0, 14, 0}, {13, 23, 1},
+    {35, 23, 1}, {53, 19, 1}, {64, 19, 1}, {75, 0, 0}, {76, 17, 0}, {83, 16, 1},
+    {97, 15, 1}, {109, 22, 1}, {129, 0, 0}, {130, 10, 0}, {142, 19, 1}, {151, 0, 0},
+    {152, 14, 0}, {168, 21, 1}, {184, 0, 0}, {0, 6, 0}, {8, 25, 1}, {18, 23, 1},
+    {31, 0, 0}, {32, 8, 0}, {35, 22, 1}, {48, 19, 1}, {60, 23, 1}, {75, 0, 0},
+    {76, 5, 0}, {80, 20, 1}, {94, 18, 1}, {108, 15, 1}, {111, 0, 0}, {112, 21, 0},
+    {133, 20, 1}, {149, 20, 1}, {158, 0, 0}, {0, 7, 0}, {5, 20, 1}, {16, 21, 1},
+    {27, 0, 0}, {28, 15, 0}, {36, 22, 1}, {48, 18, 1}, {58, 0, 0}, {59, 13, 0},
+    {68, 15, 1}, {82, 21, 1}, {92, 18, 1}, {112, 19, 1}, {129, 0, 0}, {130, 19, 0},
+    {145, 21, 1}, {155, 0, 0}, {0, 7, 0}, {9, 21, 1}, {23, 20, 1}, {36, 18, 1},
+    {47, 0, 0}, {48, 14, 0}, {57, 0, 0}, {59, 19, 1}, {70, 18, 2}, {80, 0, 0},
+    {82, 19, 1}, {93, 16, 2}, {106, 0, 0}, {108, 15, 1}, {116, 21, 2}, {129, 17, 5},
+    {139, 0, 0}, {141, 15, 1}, {156, 18, 2}, {166, 0, 0}, {0, 4, 0}, {4, 24, 1},
+    {18, 0, 0}, {19, 7, 0}, {22, 22, 1}, {33, 18, 1}, {43, 0, 0}, {44, 7, 0},
+    {51, 18, 1}, {63, 22, 1}, {73, 0, 0}, {74, 6, 0}, {78, 20, 1}, {89, 0, 0},
+    {90, 7, 0}, {99, 19, 1}, {109, 0, 0}, {110, 7, 0}, {119, 22, 1}, {131, 0, 0},
+    {132, 6, 0}, {136, 24, 1}, {155, 22, 1}, {175, 0, 0}, {176, 4, 0}, {182, 18, 1},
+    {194, 0, 0}, {0, 12, 0}, {6, 18, 1}, {17, 23, 1}, {31, 0, 0}, {32, 12, 0},
+    {40, 22, 1}, {46, 21, 1}, {52, 0, 0}, {53, 7, 0}, {62, 18, 1}, {79, 21, 1},
+    {92, 0, 0}, {93, 7, 0}, {102, 21, 1}, {120, 12, 1}, {127, 0, 0}, {128, 4, 0},
+    {134, 22, 1}, {151, 19, 1}, {165, 0, 0}, {0, 4, 0}, {6, 18, 1}, {16, 22, 1},
+    {36, 0, 0}, {37, 5, 0}, {44, 16, 1}, {58, 20, 1}, {76, 0, 0}, {77, 4, 0},
+    {80, 21, 1}, {97, 21, 1}, {105, 17, 1}, {117, 0, 0}, {118, 12, 0}, {129, 22, 1},
+    {150, 24, 1}, {169, 0, 0}, {0, 4, 0}, {4, 20, 1}, {10, 22, 1}, {24, 19, 1},
+    {40, 0, 0}, {41, 4, 0}, {45, 18, 1}, {56, 16, 1}, {67, 14, 1}, {82, 0, 0},
+    {83, 20, 0}, {103, 22, 1}, {115, 20, 1}, {128, 23, 1}, {145, 0, 0}, {146, 24, 0},
+    {164, 24, 0}, {182, 0, 0}, {0, 4, 0}, {6, 18, 1}, {23, 20, 1}, {45, 15, 1},
+    {57, 0, 0}, {58, 4, 0}, {62, 18, 1}, {73, 23, 1}, {91, 0, 0}, {92, 8, 0},
+    {99, 22, 1}, {116, 0, 0}, {117, 9, 0}, {123, 19, 1}, {134, 16, 1}, {145, 0, 0},
+    {146, 24, 0}, {161, 19, 0}, {175, 0, 0}, {0, 7, 0}, {1, 12, 1}, {9, 0, 0},
+    {9, 7, 0}, {13, 10, 1}, {18, 17, 1}, {24, 0, 0}, {24, 7, 0}, {29, 23, 1},
+    {51, 17, 1}, {70, 16, 1}, {80, 0, 0}, {80, 7, 0}, {85, 22, 1}, {98, 14, 1},
+    {103, 0, 0}, {103, 28, 0}, {119, 10, 0}, {122, 0, 0}, {0, 7, 0}, {2, 19, 1},
+    {15, 19, 1}, {25, 0, 0}, {25, 7, 0}, {27, 21, 1}, {41, 13, 1}, {50, 0, 0},
+    {50, 7, 0}, {53, 20, 1}, {74, 18, 1}, {86, 16, 1}, {92, 0, 0}, {92, 7, 0},
+    {95, 20, 1}, {106, 0, 0}, {106, 20, 0}, {115, 23, 0}, {133, 0, 0}, {0, 7, 0},
+    {3, 21, 1}, {14, 16, 1}, {20, 0, 0}, {20, 7, 0}, {22, 16, 1}, {30, 20, 1},
+    {41, 0, 0}, {41, 7, 0}, {46, 16, 1}, {54, 11, 2}, {65, 14, 2}, {73, 13, 2},
+    {83, 15, 2}, {95, 0, 0}, {95, 7, 0}, {100, 17, 1}, {111, 16, 1}, {118, 0, 0},
+    {0, 16, 0}, {9, 25, 1}, {23, 15, 1}, {29, 24, 1}, {45, 20, 1}, {56, 0, 0},
+    {57, 10, 0}, {62, 21, 1}, {81, 21, 1}, {92, 16, 1}, {95, 0, 0}, {95, 5, 0},
+    {97, 24, 1}, {104, 23, 1}, {110, 24, 1}, {118, 19, 1}, {130, 0, 0}, {0, 24, 0},
+    {13, 25, 0}, {27, 0, 0}, {27, 19, 0}, {36, 19, 1}, {45, 13, 4}, {50, 18, 1},
+    {66, 13, 4}, {71, 11, 1}, {83, 0, 0}, {84, 17, 0}, {93, 21, 1}, {113, 21, 1},
+    {132, 0, 0}, {133, 20, 0}, {143, 22, 0}, {153, 0, 0}, {0, 19, 0}, {17, 26, 0},
+    {41, 21, 0}, {50, 0, 0}, {51, 9, 0}, {56, 16, 1}, {70, 16, 1}, {80, 19, 1},
+    {96, 0, 0}, {97, 6, 0}, {102, 22, 1}, {116, 21, 1}, {125, 19, 1}, {133, 0, 0},
+    {134, 24, 0}, {152, 25, 0}, {170, 20, 0}, {184, 0, 0}, {0, 22, 0}, {13, 25, 0},
+    {22, 0, 0}, {23, 6, 0}, {28, 23, 1}, {39, 22, 1}, {48, 0, 0}, {49, 24, 0},
+    {58, 10, 1}, {69, 16, 3}, {85, 19, 5}, {102, 2, 3}, {106, 1, 1}, {108, 0, 0},
+    {109, 10, 0}, {115, 22, 1}, {130, 20, 1}, {138, 22, 1}, {155, 0, 0}, {0, 23, 0},
+    {16, 18, 0}, {24, 0, 0}, {25, 24, 0}, {46, 22, 0}, {61, 22, 0}, {81, 0, 0},
+    {82, 7, 0}, {87, 22, 1}, {98, 20, 1}, {113, 0, 0}, {114, 9, 0}, {119, 20, 1},
+    {131, 20, 1}, {150, 21, 1}, {172, 0, 0}, {173, 20, 0}, {189, 24, 0}, {211, 0, 0},
+    {0, 24, 0}, {12, 22, 1}, {19, 0, 0}, {20, 11, 0}, {26, 20, 1}, {39, 18, 3},
+    {50, 0, 0}, {51, 12, 0}, {59, 17, 1}, {64, 20, 3}, {64, 0, 0}, {65, 25, 0},
+    {84, 14, 0}, {96, 0, 0}, {97, 23, 0}, {113, 22, 0}, {129, 21, 0}, {148, 0, 0},
+    {0, 17, 0}, {8, 0, 0}, {10, 21, 1}, {19, 10, 3}, {26, 0, 0}, {27, 10, 0},
+    {36, 21, 1}, {51, 21, 1}, {62, 21, 1}, {73, 20, 1}, {73, 0, 0}, {74, 24, 0},
+    {81, 25, 0}, {101, 0, 0}, {102, 11, 0}, {109, 11, 1}, {122, 9, 1}, {132, 0, 0},
+    {133, 26, 0}, {152, 20, 0}, {160, 0, 0}, {0, 22, 0}, {20, 14, 1}, {24, 22, 1},
+    {42, 0, 0}, {43, 17, 0}, {54, 0, 0}, {56, 19, 1}, {75, 14, 2}, {86, 12, 2},
+    {93, 0, 0}, {95, 17, 1}, {112, 20, 2}, {135, 13, 2}, {145, 0, 0}, {147, 15, 1},
+    {162, 15, 2}, {173, 11, 2}, {179, 0, 0}, {180, 18, 0}, {196, 22, 0}, {213, 0, 0},
+};
+
+static const uint16_t manual_line_first[LAYOUT_SECTION_COUNT + 1] = {
+    0, 18, 37, 53, 72, 90, 107, 127, 147, 166, 183, 201,
+    218, 238, 265, 285, 302, 320, 339, 358, 377, 396, 413, 430,
+    448, 467, 486, 504, 525, 546,
+};
+
+static const uint8_t manual_line_skip[] = {
+    0, 1, 0, 0, 0, 0, 1, 2, 0, 2, 3, 0, 2, 0, 12, 0, 3, 0, 0, 3, 0, 0, 0, 0,
+    2, 3, 3, 1, 2, 3, 0, 0, 3, 0, 0, 0, 0, 0, 0, 1, 2, 0, 1, 0, 1, 2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+    2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 1, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 0, 0, 0, 0, 0, 0, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 3, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0,
+    0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 3, 0, 0, 0, 1, 0, 0, 3, 0, 0, 2,
+    0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 2, 2, 0, 0,
+    0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 2, 0, 0,
+    0, 0, 0, 0, 3, 1, 2, 1, 0, 1, 2, 0, 0, 0, 1, 2, 0, 0, 1, 2, 0, 0, 0, 2,
+    1, 1, 2, 3, 0, 1, 2, 2, 0, 1, 1, 2, 2, 1, 2, 0, 0, 0, 1, 0, 1, 2, 3, 1,
+    1, 2, 0, 3, 3, 3, 3, 1, 2, 0, 1, 0, 0, 3, 0, 0, 0, 0, 0, 2, 0, 0, 1, 2,
+    0, 0, 0, 1, 0, 0, 0, 2, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 1, 1, 0, 0, 3,
+    0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 3, 0, 0, 0, 3, 0, 21, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 21, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const LayoutLine manual_dense_lines[] = {
+    {0, 16, 0}, {9, 23, 1}, {24, 11, 3}, {29, 0, 0}, {30, 12, 0}, {44, 24, 1},
+    {56, 0, 0}, {56, 27, 0}, {71, 18, 0}, {75, 0, 0}, {75, 13, 0}, {84, 24, 1},
+    {91, 11, 3}, {91, 0, 0}, {92, 15, 0}, {103, 12, 1}, {108, 0, 0}, {0, 27, 0},
+    {14, 6, 1}, {17, 0, 0}, {18, 29, 0}, {28, 29, 0}, {40, 16, 0}, {43, 0, 0},
+    {43, 12, 0}, {46, 12, 1}, {54, 0, 0}, {54, 20, 0}, {65, 17, 1}, {79, 0, 0},
+    {80, 21, 0}, {97, 22, 1}, {104, 0, 0}, {105, 24, 0}, {121, 25, 0}, {139, 0, 0},
+    {0, 20, 0}, {16, 17, 1}, {33, 0, 0}, {33, 13, 0}, {44, 19, 1}, {52, 11, 1},
+    {60, 19, 1}, {69, 0, 0}, {69, 12, 0}, {76, 13, 1}, {86, 21, 1}, {91, 25, 1},
+    {98, 0, 0}, {99, 23, 0}, {109, 23, 0}, {127, 0, 0}, {0, 25, 0}, {23, 0, 0},
+    {24, 26, 0}, {41, 12, 3}, {46, 24, 3}, {65, 0, 0}, {66, 10, 0}, {71, 24, 3},
+    {80, 11, 5}, {80, 0, 0}, {81, 16, 0}, {85, 22, 1}, {102, 17, 1}, {118, 25, 1},
+    {141, 0, 0}, {142, 23, 0}, {166, 24, 0}, {186, 0, 0}, {0, 28, 0}, {22, 22, 0},
+    {34, 0, 0}, {34, 19, 0}, {47, 8, 1}, {50, 9, 3}, {52, 8, 3}, {57, 4, 3},
+    {62, 6, 3}, {66, 12, 3}, {75, 0, 0}, {76, 27, 0}, {92, 17, 0}, {100, 0, 0},
+    {101, 23, 0}, {115, 30, 0}, {126, 11, 0}, {135, 0, 0}, {0, 26, 0}, {11, 24, 0},
+    {20, 24, 0}, {30, 0, 0}, {31, 22, 0}, {43, 21, 1}, {51, 20, 1}, {66, 20, 1},
+    {76, 21, 1}, {87, 20, 1}, {100, 0, 0}, {101, 25, 0}, {110, 28, 0}, {128, 18, 0},
+    {139, 0, 0}, {140, 25, 0}, {155, 0, 0}, {0, 29, 0}, {19, 13, 0}, {23, 0, 0},
+    {24, 6, 0}, {26, 22, 1}, {34, 17, 4}, {38, 13, 1}, {45, 23, 1}, {63, 8, 4},
+    {67, 24, 1}, {77, 0, 0}, {78, 18, 0}, {91, 20, 1}, {108, 19, 1}, {116, 16, 1},
+    {125, 23, 1}, {134, 0, 0}, {135, 23, 0}, {150, 22, 0}, {167, 0, 0}, {0, 29, 0},
+    {16, 17, 0}, {20, 0, 0}, {20, 10, 0}, {28, 8, 1}, {33, 13, 3}, {37, 7, 3},
+    {44, 15, 5}, {53, 0, 0}, {54, 14, 0}, {60, 20, 1}, {79, 16, 1}, {82, 0, 0},
+    {83, 8, 0}, {87, 18, 1}, {96, 22, 1}, {112, 0, 0}, {113, 24, 0}, {125, 22, 0},
+    {137, 0, 0}, {0, 27, 0}, {17, 27, 0}, {25, 0, 0}, {26, 9, 0}, {34, 19, 1},
+    {47, 0, 0}, {48, 25, 0}, {67, 26, 0}, {79, 15, 0}, {83, 0, 0}, {84, 8, 0},
+    {89, 18, 1}, {102, 19, 1}, {112, 20, 1}, {127, 18, 1}, {145, 0, 0}, {146, 29, 0},
+    {160, 15, 0}, {170, 0, 0}, {0, 14, 0}, {13, 23, 1}, {35, 23, 1}, {53, 19, 1},
+    {64, 19, 1}, {75, 0, 0}, {76, 17, 0}, {83, 16, 1}, {97, 15, 1}, {109, 22, 1},
+    {129, 0, 0}, {130, 10, 0}, {142, 19, 1}, {151, 0, 0}, {152, 14, 0}, {168, 21, 1},
+    {184, 0, 0}, {0, 6, 0}, {8, 25, 1}, {18, 23, 1}, {31, 0, 0}, {32, 8, 0},
+    {35, 22, 1}, {48, 19, 1}, {60, 23, 1}, {75, 0, 0}, {76, 5, 0}, {80, 20, 1},
+    {94, 18, 1}, {108, 15, 1}, {111, 0, 0}, {112, 21, 0}, {133, 20, 1}, {149, 20, 1},
+    {158, 0, 0}, {0, 7, 0}, {5, 20, 1}, {16, 21, 1}, {27, 0, 0}, {28, 15, 0},
+    {36, 22, 1}, {48, 18, 1}, {58, 0, 0}, {59, 13, 0}, {68, 15, 1}, {82, 21, 1},
+    {92, 18, 1}, {112, 19, 1}, {129, 0, 0}, {130, 19, 0}, {145, 21, 1}, {155, 0, 0},
+    {0, 7, 0}, {9, 21, 1}, {23, 20, 1}, {36, 18, 1}, {47, 0, 0}, {48, 14, 0},
+    {57, 0, 0}, {59, 19, 1}, {70, 18, 2}, {80, 0, 0}, {82, 19, 1}, {93, 16, 2},
+    {106, 0, 0}, {108, 15, 1}, {116, 21, 2}, {129, 17, 5}, {139, 0, 0}, {141, 15, 1},
+    {156, 18, 2}, {166, 0, 0}, {0, 4, 0}, {4, 24, 1}, {18, 0, 0}, {19, 7, 0},
+    {22, 22, 1}, {33, 18, 1}, {43, 0, 0}, {44, 7, 0}, {51, 18, 1}, {63, 22, 1},
+    {73, 0, 0}, {74, 6, 0}, {78, 20, 1}, {89, 0, 0}, {90, 7, 0}, {99, 19, 1},
+    {109, 0, 0}, {110, 7, 0}, {119, 22, 1}, {131, 0, 0}, {132, 6, 0}, {136, 24, 1},
+    {155, 22, 1}, {175, 0, 0}, {176, 4, 0}, {182, 18, 1}, {194, 0, 0}, {0, 12, 0},
+    {6, 18, 1}, {17, 23, 1}, {31, 0, 0}, {32, 12, 0}, {40, 22, 1}, {46, 21, 1},
+    {52, 0, 0}, {53, 7, 0}, {62, 18, 1}, {79, 21, 1}, {92, 0, 0}, {93, 7, 0},
+    {102, 21, 1}, {120, 12, 1}, {127, 0, 0}, {128, 4, 0}, {134, 22, 1}, {151, 19, 1},
+    {165, 0, 0}, {0, 4, 0}, {6, 18, 1}, {16, 22, 1}, {36, 0, 0}, {37, 5, 0},
+    {44, 16, 1}, {58, 20, 1}, {76, 0, 0}, {77, 4, 0}, {80, 21, 1}, {97, 21, 1},
+    {105, 17, 1}, {117, 0, 0}, {118, 12, 0}, {129, 22, 1}, {150, 24, 1}, {169, 0, 0},
+    {0, 4, 0}, {4, 20, 1}, {10, 22, 1}, {24, 19, 1}, {40, 0, 0}, {41, 4, 0},
+    {45, 18, 1}, {56, 16, 1}, {67, 14, 1}, {82, 0, 0}, {83, 20, 0}, {103, 22, 1},
+    {115, 20, 1}, {128, 23, 1}, {145, 0, 0}, {146, 29, 0}, {169, 19, 0}, {182, 0, 0},
+    {0, 4, 0}, {6, 18, 1}, {23, 20, 1}, {45, 15, 1}, {57, 0, 0}, {58, 4, 0},
+    {62, 18, 1}, {73, 23, 1}, {91, 0, 0}, {92, 8, 0}, {99, 22, 1}, {116, 0, 0},
+    {117, 9, 0}, {123, 19, 1}, {134, 16, 1}, {145, 0, 0}, {146, 28, 0}, {162, 15, 0},
+    {175, 0, 0}, {0, 7, 0}, {1, 12, 1}, {9, 0, 0}, {9, 7, 0}, {13, 10, 1},
+    {18, 17, 1}, {24, 0, 0}, {24, 7, 0}, {29, 23, 1}, {51, 17, 1}, {70, 16, 1},
+    {80, 0, 0}, {80, 7, 0}, {85, 22, 1}, {98, 14, 1}, {103, 0, 0}, {103, 28, 0},
+    {119, 10, 0}, {122, 0, 0}, {0, 7, 0}, {2, 19, 1}, {15, 19, 1}, {25, 0, 0},
+    {25, 7, 0}, {27, 21, 1}, {41, 13, 1}, {50, 0, 0}, {50, 7, 0}, {53, 20, 1},
+    {74, 18, 1}, {86, 16, 1}, {92, 0, 0}, {92, 7, 0}, {95, 20, 1}, {106, 0, 0},
+    {106, 20, 0}, {115, 23, 0}, {133, 0, 0}, {0, 7, 0}, {3, 21, 1}, {14, 16, 1},
+    {20, 0, 0}, {20, 7, 0}, {22, 16, 1}, {30, 20, 1}, {41, 0, 0}, {41, 7, 0},
+    {46, 16, 1}, {54, 11, 2}, {65, 14, 2}, {73, 13, 2}, {83, 15, 2}, {95, 0, 0},
+    {95, 7, 0}, {100, 17, 1}, {111, 16, 1}, {118, 0, 0}, {0, 16, 0}, {9, 25, 1},
+    {23, 15, 1}, {29, 24, 1}, {45, 20, 1}, {56, 0, 0}, {57, 10, 0}, {62, 21, 1},
+    {81, 21, 1}, {92, 16, 1}, {95, 0, 0}, {95, 5, 0}, {97, 24, 1}, {104, 23, 1},
+    {110, 24, 1}, {118, 19, 1}, {130, 0, 0}, {0, 30, 0}, {16, 19, 0}, {27, 0, 0},
+    {27, 19, 0}, {36, 19, 1}, {45, 13, 4}, {50, 18, 1}, {66, 13, 4}, {71, 11, 1},
+    {83, 0, 0}, {84, 17, 0}, {93, 21, 1}, {113, 21, 1}, {132, 0, 0}, {133, 28, 0},
+    {144, 14, 0}, {153, 0, 0}, {0, 19, 0}, {17, 26, 0}, {41, 21, 0}, {50, 0, 0},
+    {51, 9, 0}, {56, 16, 1}, {70, 16, 1}, {80, 19, 1}, {96, 0, 0}, {97, 6, 0},
+    {102, 22, 1}, {116, 21, 1}, {125, 19, 1}, {133, 0, 0}, {134, 24, 0}, {152, 30, 0},
+    {171, 15, 0}, {184, 0, 0}, {0, 22, 0}, {13, 25, 0}, {22, 0, 0}, {23, 6, 0},
+    {28, 23, 1}, {39, 22, 1}, {48, 0, 0}, {49, 24, 0}, {58, 10, 1}, {69, 16, 3},
+    {85, 19, 5}, {102, 2, 3}, {106, 1, 1}, {108, 0, 0}, {109, 10, 0}, {115, 22, 1},
+    {130, 20, 1}, {138, 22, 1}, {155, 0, 0}, {0, 30, 0}, {17, 11, 0}, {24, 0, 0},
+    {25, 30, 0}, {51, 29, 0}, {74, 9, 0}, {81, 0, 0}, {82, 7, 0}, {87, 22, 1},
+    {98, 20, 1}, {113, 0, 0}, {114, 9, 0}, {119, 20, 1}, {131, 20, 1}, {150, 21, 1},
+    {172, 0, 0}, {173, 29, 0}, {197, 15, 0}, {211, 0, 0}, {0, 24, 0}, {12, 22, 1},
+    {19, 0, 0}, {20, 11, 0}, {26, 20, 1}, {39, 18, 3}, {50, 0, 0}, {51, 12, 0},
+    {59, 17, 1}, {64, 20, 3}, {64, 0, 0}, {65, 29, 0}, {88, 10, 0}, {96, 0, 0},
+    {97, 23, 0}, {113, 22, 0}, {129, 21, 0}, {148, 0, 0}, {0, 17, 0}, {8, 0, 0},
+    {10, 21, 1}, {19, 10, 3}, {26, 0, 0}, {27, 10, 0}, {36, 21, 1}, {51, 21, 1},
+    {62, 21, 1}, {73, 20, 1}, {73, 0, 0}, {74, 24, 0}, {81, 25, 0}, {101, 0, 0},
+    {102, 11, 0}, {109, 11, 1}, {122, 9, 1}, {132, 0, 0}, {133, 30, 0}, {153, 16, 0},
+    {160, 0, 0}, {0, 22, 0}, {20, 14, 1}, {24, 22, 1}, {42, 0, 0}, {43, 17, 0},
+    {54, 0, 0}, {56, 19, 1}, {75, 14, 2}, {86, 12, 2}, {93, 0, 0}, {95, 17, 1},
+    {112, 20, 2}, {135, 13, 2}, {145, 0, 0}, {147, 15, 1}, {162, 15, 2}, {173, 11, 2},
+    {179, 0, 0}, {180, 29, 0}, {204, 11, 0}, {213, 0, 0},
+};
+
+static const uint16_t manual_dense_line_first[LAYOUT_SECTION_COUNT + 1] = {
+    0, 17, 36, 52, 70, 88, 105, 125, 145, 164, 181, 199,
+    216, 236, 263, 283, 300, 318, 337, 356, 375, 394, 411, 428,
+    446, 465, 484, 502, 523, 544,
+};
+
+static const uint8_t manual_dense_line_skip[] = {
+    0, 1, 0, 0, 0, 0, 1, 2, 0, 2, 3, 0, 0, 12, 0, 3, 0, 0, 3, 0, 0, 1, 1, 2,
+    3, 3, 1, 2, 3, 0, 0, 3, 0, 0, 0, 0, 0, 0, 1, 2, 0, 1, 0, 1, 2, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 2, 2, 2,
+    2, 2, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 3, 1, 0, 0, 0, 0, 0, 0, 0, 2, 2,
+    2, 0, 0, 0, 0, 0, 1, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0,
+    0, 0, 0, 0, 2, 2, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 3, 0, 0, 0, 1, 0, 0, 3, 0, 0, 2, 0, 0,
+    0, 0, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 2, 2, 0, 0, 0, 2,
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0,
+    0, 0, 3, 1, 2, 1, 0, 1, 2, 0, 0, 0, 1, 2, 0, 0, 1, 2, 0, 0, 0, 2, 1, 1,
+    2, 3, 0, 1, 2, 2, 0, 1, 1, 2, 2, 1, 2, 0, 0, 0, 1, 0, 1, 2, 3, 1, 1, 2,
+    0, 3, 3, 3, 3, 1, 2, 0, 1, 0, 0, 3, 0, 0, 0, 0, 0, 2, 0, 0, 1, 2, 0, 0,
+    0, 1, 0, 0, 0, 2, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 1, 0, 0, 1, 0, 3, 0, 1, 1, 0, 0, 3, 0, 0,
+    0, 0, 1, 0, 0, 3, 0, 0, 3, 0, 0, 0, 3, 0, 21, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 2, 0, 21, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const LayoutLine quiz_lines[] = {
+    {0, 23, 0}, {24, 8, 0}, {0, 26, 0}, {0, 20, 0}, {21, 18, 0}, {0, 27, 0},
+    {28, 6, 0}, {0, 20, 0}, {21, 12, 0}, {0, 25, 0}, {26, 9, 0}, {0, 25, 0},
+    {26, 7, 0}, {0, 25, 0}, {0, 24, 0}, {25, 9, 0}, {0, 25, 0}, {26, 12, 0},
+    {0, 20, 0}, {21, 12, 0}, {0, 20, 0}, {21, 17, 0}, {0, 24, 0}, {25, 12, 0},
+    {0, 19, 0}, {20, 21, 0}, {0, 27, 0}, {28, 12, 0}, {0, 23, 0}, {24, 14, 0},
+    {0, 27, 0}, {0, 26, 0}, {27, 11, 0}, {0, 25, 0}, {0, 26, 0}, {27, 9, 0},
+    {0, 12, 0}, {0, 15, 0}, {16, 14, 0}, {0, 22, 0}, {23, 9, 0}, {0, 16, 0},
+    {17, 15, 0},
+};
+
+static const uint16_t quiz_line_first[LAYOUT_QUIZ_COUNT + 1] = {
+    0, 2, 3, 5, 7, 9, 11, 13, 14, 16, 18, 20,
+    22, 24, 26, 28, 30, 31, 33, 34, 36, 37, 39, 41,
+    43,
+};
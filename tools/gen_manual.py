@@ -0,0 +1,308 @@
+#!/usr/bin/env python3
+"""gen_manual.py — Build the manual tables, docs and SD chapters from manual/manual.txt
+
+Usage:
+  tools/gen_manual.py               # rewrite manual_content.h and docs/MANUAL_CONTENT.md
+  tools/gen_manual.py --sd DIR      # also write one .txt chapter per category to DIR
+  tools/gen_manual.py --check       # exit 1 if either output is stale
+
+manual/manual.txt is the only place the manual and quiz text is edited; see
+the comment at its top for the format. From it this writes:
+
+  manual_content.h         ManualSection tables, categories[] and quiz_cards[]
+  docs/MANUAL_CONTENT.md   the same text for reading on GitHub, plus the
+                           category list inside docs/USER_MANUAL.md
+  DIR/NN_<category>.txt    plain-text chapters for the SD card (--sd)
+
+Section text is interned: substrings repeated across sections ("claude --",
+"CLAUDE.md", slash commands, ...) are stored once in manual_fragments[] and
+replaced in the text by one byte, 0x80 + fragment index. The app expands
+them while drawing (see manual_next() in claude_remote.c). Titles and quiz
+strings are left alone; identical literals are already merged by the
+compiler and linker. gen_search_index.py and gen_manual_layout.py read the
+same source, so run all three after editing it.
+"""
+
+import argparse
+import os
+import re
+import sys
+from collections import Counter
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+REPO = os.path.dirname(HERE)
+SOURCE = os.path.join(REPO, "manual", "manual.txt")
+HEADER = os.path.join(REPO, "manual_content.h")
+DOC = os.path.join(REPO, "docs", "MANUAL_CONTENT.md")
+USER_MANUAL = os.path.join(REPO, "docs", "USER_MANUAL.md")
+
+QUIZ = "Quiz"
+FRAGMENT_MAX = 128  # ids 0x80..0xFF
+FRAGMENT_MIN_LEN = 4
+FRAGMENT_MAX_LEN = 24
+CATEGORY_MARK = ("<!-- manual:categories -->", "<!-- /manual:categories -->")
+
+
+def parse(path=SOURCE):
+    """([(category, [(title, content)])], [(description, answer, options, correct)])"""
+    categories, quiz = [], []
+    section = card = None
+
+    def close_section():
+        if section is not None:
+            lines = section[1]
+            while lines and lines[-1] == "":
+                lines.pop()
+            categories[-1][1].append((section[0], "".join(l + "\n" for l in lines)))
+
+    with open(path) as f:
+        raw_lines = f.read().split("\n")
+    for num, line in enumerate(raw_lines, 1):
+        where = "%s:%d" % (os.path.relpath(path, REPO), num)
+        if line.startswith(";;"):
+            continue
+        if line.startswith("# "):
+            close_section()
+            section = None
+            categories.append((line[2:].strip(), []))
+            continue
+        if not categories:
+            if line.strip():
+                raise ValueError("%s: text before the first category" % where)
+            continue
+        if categories[-1][0] == QUIZ:
+            if not line.strip():
+                card = None
+                continue
+            tag, text = line[:2], line[2:]
+            if card is None:
+                card = {"desc": [], "answer": None, "options": [], "correct": None}
+                quiz.append(card)
+            if tag == "? ":
+                card["desc"].append(text)
+            elif tag == "= ":
+                card["answer"] = text
+            elif tag in ("* ", "- "):
+                if tag == "* ":
+                    card["correct"] = len(card["options"])
+                card["options"].append(text)
+            else:
+                raise ValueError("%s: quiz lines start with '? ', '= ', '* ' or '- '" % where)
+            continue
+        if line.startswith("## "):
+            close_section()
+            section = (line[3:].strip(), [])
+            continue
+        if section is None:
+            if line.strip():
+                raise ValueError("%s: text before the first section" % where)
+            continue
+        section[1].append(line)
+    close_section()
+
+    categories = [c for c in categories if c[0] != QUIZ]
+    cards = []
+    for i, card in enumerate(quiz):
+        if not card["desc"] or card["answer"] is None or len(card["options"]) != 3 or \
+           card["correct"] is None:
+            raise ValueError("quiz card %d: needs '?', '=', and three options, one marked '*'" % i)
+        cards.append(("\n".join(card["desc"]), card["answer"], card["options"], card["correct"]))
+    for _, sections in categories:
+        for title, content in sections:
+            if any(ord(c) >= 0x80 for c in content):
+                raise ValueError("%s: section text must be ASCII" % title)
+    return categories, cards
+
+
+def load():
+    """(sections, quiz) for the index and layout tools: sections as
+    (title, content) in menu order, quiz cards as (description, answer)."""
+    categories, cards = parse()
+    sections = [s for _, secs in categories for s in secs]
+    return sections, [(c[0], c[1]) for c in cards]
+
+
+def intern(texts):
+    """Pick fragments greedily by bytes saved and return (fragments,
+    encoded texts). A fragment costs its length + 1 plus a 4-byte pointer;
+    each use saves its length - 1."""
+    work = list(texts)
+    fragments = []
+    while len(fragments) < FRAGMENT_MAX:
+        counts = Counter()
+        for text in work:
+            for n in range(FRAGMENT_MIN_LEN, FRAGMENT_MAX_LEN + 1):
+                for i in range(len(text) - n + 1):
+                    sub = text[i:i + n]
+                    if not any(ord(c) >= 0x80 for c in sub):
+                        counts[sub] += 1
+        # rank by overlapping counts, then take the first whose real
+        # (non-overlapping) count still pays for it
+        ranked = sorted(
+            ((n * (len(sub) - 1) - (len(sub) + 1 + 4), sub) for sub, n in counts.items() if n > 1),
+            key=lambda r: (-r[0], r[1]))
+        best = None
+        for _, sub in ranked:
+            uses = sum(text.count(sub) for text in work)
+            if uses * (len(sub) - 1) - (len(sub) + 1 + 4) > 0:
+                best = sub
+                break
+        if best is None:
+            break
+        mark = chr(0x80 + len(fragments))
+        work = [text.replace(best, mark) for text in work]
+        fragments.append(best)
+    return fragments, work
+
+
+def c_literal(text):
+    out = []
+    for c in text:
+        if c == "\n":
+            out.append("\\n")
+        elif c in '"\\':
+            out.append("\\" + c)
+        elif ord(c) >= 0x80:
+            out.append("\\%03o" % ord(c))  # fixed width, so a digit after it is not eaten
+        else:
+            out.append(c)
+    return '"%s"' % "".join(out)
+
+
+def c_lines(text, indent):
+    """A string literal split after each newline, one source line each."""
+    parts = text.split("\n")
+    pieces = [p + "\n" for p in parts[:-1]] + ([parts[-1]] if parts[-1] else [])
+    return ("\n" + indent).join(c_literal(p) for p in pieces) if pieces else '""'
+
+
+def slug(name):
+    return re.sub(r"[^a-z0-9]+", "_", name.lower()).strip("_")
+
+
+def render_header(categories, cards):
+    contents = [c for _, secs in categories for _, c in secs]
+    fragments, encoded = intern(contents)
+    plain = sum(len(c) + 1 for c in contents)
+    packed = sum(len(c) + 1 for c in encoded) + sum(len(f) + 1 + 4 for f in fragments)
+
+    out = [
+        "/* Generated by tools/gen_manual.py from manual/manual.txt. Do not edit. */",
+        "",
+        "/* section text: %d bytes as written, %d interned (%d fragments) */" % (
+            plain, packed, len(fragments)),
+        "static const char* const manual_fragments[] = {",
+    ]
+    for f in fragments:
+        out.append("    %s," % c_literal(f))
+    out += ["};", ""]
+
+    it = iter(encoded)
+    for name, sections in categories:
+        out.append("static const ManualSection %s_sections[] = {" % slug(name))
+        for title, _ in sections:
+            out.append("    {%s," % c_literal(title))
+            out.append("     %s}," % c_lines(next(it), "     "))
+        out += ["};", ""]
+
+    out.append("static const ManualCategory categories[] = {")
+    for name, sections in categories:
+        out.append("    {%s, %s_sections, %d}," % (c_literal(name), slug(name), len(sections)))
+    out += ["};", "", "#define CATEGORY_COUNT %d" % len(categories), ""]
+
+    out.append("static const QuizCard quiz_cards[] = {")
+    for desc, answer, options, correct in cards:
+        out.append("    {QuizTypeMultiChoice, %s," % c_literal(desc))
+        out.append("     %s, %s, %d}," % (
+            c_literal(answer), ", ".join(c_literal(o) for o in options), correct))
+    out += ["};", "", "#define QUIZ_CARD_COUNT %d" % len(cards), ""]
+    return "\n".join(out)
+
+
+def render_doc(categories, cards):
+    out = [
+        "# Manual Content",
+        "",
+        "<!-- Generated by tools/gen_manual.py from manual/manual.txt. Do not edit. -->",
+        "",
+        "The built-in manual and quiz, as the Flipper shows them.",
+        "",
+    ]
+    for name, sections in categories:
+        out += ["## " + name, ""]
+        for title, content in sections:
+            out += ["### " + title, "", "```", content.rstrip("\n"), "```", ""]
+    out += ["## Quiz", "", "| Question | Answer |", "|----------|--------|"]
+    for desc, answer, _, _ in cards:
+        cell = lambda s: s.replace("\n", " ").replace("|", "\\|")
+        out.append("| %s | `%s` |" % (cell(desc), cell(answer)))
+    out.append("")
+    return "\n".join(out)
+
+
+def category_list(categories, cards):
+    lines = []
+    for i, (name, sections) in enumerate(categories, 1):
+        lines.append("%d. %s — %s" % (i, name, ", ".join(t for t, _ in sections)))
+    lines.append("")
+    lines.append("Plus a **Quiz Mode** with %d multiple-choice cards on a Leitner schedule, streak "
+                 "tracking, and score. The full text is in [MANUAL_CONTENT.md](MANUAL_CONTENT.md)." % len(cards))
+    return "\n".join(lines)
+
+
+def render_user_manual(categories, cards):
+    with open(USER_MANUAL) as f:
+        text = f.read()
+    start, end = CATEGORY_MARK
+    i, j = text.index(start) + len(start), text.index(end)
+    return text[:i] + "\n" + category_list(categories, cards) + "\n" + text[j:]
+
+
+def write_sd(categories, out_dir):
+    os.makedirs(out_dir, exist_ok=True)
+    for i, (name, sections) in enumerate(categories, 1):
+        path = os.path.join(out_dir, "%02d_%s.txt" % (i, slug(name)))
+        with open(path, "w") as f:
+            f.write("\n".join("%s\n\n%s" % (t, c) for t, c in sections))
+        print(os.path.relpath(path))
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    ap.add_argument("--sd", metavar="DIR", help="also write SD card chapters to DIR")
+    ap.add_argument("--check", action="store_true", help="fail if an output is out of date")
+    args = ap.parse_args()
+
+    categories, cards = parse()
+    outputs = [
+        (HEADER, render_header(categories, cards)),
+        (DOC, render_doc(categories, cards)),
+        (USER_MANUAL, render_user_manual(categories, cards)),
+    ]
+
+    if args.check:
+        stale = []
+        for path, text in outputs:
+            try:
+                with open(path) as f:
+                    if f.read() == text:
+                        continue
+            except OSError:
+                pass
+            stale.append(os.path.relpath(path, REPO))
+        if stale:
+            print("stale: %s; run tools/gen_manual.py" % ", ".join(stale), file=sys.stderr)
+            return 1
+        return 0
+
+    for path, text in outputs:
+        with open(path, "w") as f:
+            f.write(text)
+        print(os.path.relpath(path, REPO))
+    if args.sd:
+        write_sd(categories, args.sd)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,302 @@
+#!/usr/bin/env python3
+"""gen_manual_layout.py — Pre-wrap the manual and quiz text from manual/manual.txt
+
+Usage:
+  tools/gen_manual_layout.py
+  tools/gen_manual_layout.py --fonts <firmware>/lib/u8g2/u8g2_fonts.c
+  tools/gen_manual_layout.py --check        # exit 1 if manual_layout.h is stale
+
+Wraps every manual section and quiz question to the pixel width the device
+draws it at, and writes the result to manual_layout.h as line tables. Each
+line is a span of the text as stored (offset, length, indent), so no text is
+stored twice; a newline inside a span is drawn as a space. Section offsets
+index the string gen_manual.py interned, and a line that starts inside a
+fragment also gets its distance into it in the _line_skip table, so the app
+starts reading at the line instead of expanding the section up to it.
+Lengths count expanded characters.
+
+Glyph advances for the firmware's proportional fonts (FontSecondary is
+u8g2_font_haxrcorp4089_tr, FontPrimary u8g2_font_helvB08_tr) are kept in
+ADVANCES below, so the layout doesn't depend on a firmware checkout. With
+--fonts the tool decodes the same fonts from the u8g2 source and stops if
+the tables disagree with it. FontKeyboard (u8g2_font_profont11_mr) and the
+dense view's u8g2_font_4x6_tr are fixed-width.
+
+The dense view gets its own table, wrapped for 4x6. When it comes out the
+same as the body table, the header aliases one to the other instead of
+storing it twice.
+
+Hand-wrapped prose is reflowed: a line joins the one before when both are
+unindented, the earlier one doesn't end in ':' and the later one starts with
+a lowercase letter. Indented lines (commands, examples) and list items keep
+their own lines and wrap with their indent.
+"""
+
+import argparse
+import os
+import re
+import sys
+
+from gen_manual import REPO, intern, load
+
+OUTPUT = os.path.join(REPO, "manual_layout.h")
+
+FONTS = {
+    "FontPrimary": "u8g2_font_helvB08_tr",
+    "FontSecondary": "u8g2_font_haxrcorp4089_tr",
+    "FontKeyboard": "u8g2_font_profont11_mr",
+}
+# fixed-width fonts: one advance for every glyph
+FIXED_ADVANCES = {
+    "u8g2_font_4x6_tr": 4,
+    "u8g2_font_profont11_mr": 6,
+}
+GLYPHS = "".join(chr(c) for c in range(0x20, 0x7F))
+# delta x of each glyph ' ' to '~' in the proportional fonts, 16 a row
+ADVANCES = {
+    "u8g2_font_haxrcorp4089_tr": dict(zip(GLYPHS, [
+        3, 2, 4, 6, 6, 6, 6, 2, 3, 3, 6, 6, 3, 4, 2, 4,  # ' ' to '/'
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 2, 3, 4, 5, 4, 5,  # '0' to '?'
+        6, 6, 5, 5, 5, 5, 5, 5, 5, 4, 5, 5, 5, 6, 6, 5,  # '@' to 'O'
+        5, 6, 5, 5, 6, 5, 6, 6, 6, 6, 5, 3, 4, 3, 4, 5,  # 'P' to '_'
+        3, 5, 5, 5, 5, 5, 4, 5, 5, 2, 3, 5, 2, 6, 5, 5,  # '`' to 'o'
+        5, 5, 4, 5, 4, 5, 6, 6, 6, 5, 5, 4, 2, 4, 5,     # 'p' to '~'
+    ])),
+    "u8g2_font_helvB08_tr": dict(zip(GLYPHS, [
+        2, 3, 4, 5, 5, 8, 7, 2, 3, 3, 4, 5, 2, 4, 2, 3,  # ' ' to '/'
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 2, 2, 4, 5, 4, 5,  # '0' to '?'
+        9, 6, 6, 6, 6, 5, 5, 6, 6, 2, 5, 6, 5, 8, 6, 6,  # '@' to 'O'
+        6, 6, 6, 6, 6, 6, 6, 8, 6, 6, 6, 3, 3, 3, 5, 5,  # 'P' to '_'
+        3, 5, 5, 5, 5, 5, 3, 5, 5, 2, 2, 5, 2, 8, 5, 5,  # '`' to 'o'
+        5, 5, 3, 5, 3, 5, 5, 6, 5, 5, 4, 3, 2, 3, 5,     # 'p' to '~'
+    ])),
+}
+BODY_FONT = "FontSecondary"
+DENSE_FONT = "u8g2_font_4x6_tr"
+READ_WIDTH = 120  # x = 2, clear of the scroll marks at the right edge
+QUIZ_WIDTH = 120  # x = 4
+LINE_MAX = 47  # the app's 48-byte line buffers, less the NUL
+
+
+def font_bytes(fonts_c, name):
+    """The u8g2 font array called name, decoded from its C string."""
+    with open(fonts_c) as f:
+        src = f.read()
+    m = re.search(r"\b%s\s*\[\s*\d+\s*\][^=]*=\s*((?:\s*\"(?:[^\"\\]|\\.)*\")+)" % name, src)
+    if not m:
+        raise ValueError("%s not found in %s" % (name, fonts_c))
+    out = bytearray()
+    for lit in re.findall(r'"((?:[^"\\]|\\.)*)"', m.group(1)):
+        i = 0
+        while i < len(lit):
+            c = lit[i]
+            if c != "\\":
+                out.append(ord(c))
+                i += 1
+                continue
+            oct_m = re.match(r"[0-7]{1,3}", lit[i + 1:])
+            if oct_m:
+                out.append(int(oct_m.group(0), 8))
+                i += 1 + len(oct_m.group(0))
+            else:
+                out.append(ord({"n": "\n", "t": "\t", "r": "\r"}.get(lit[i + 1], lit[i + 1])))
+                i += 2
+    return bytes(out)
+
+
+def font_advances(data):
+    """{char: delta x} for the ASCII glyphs of a u8g2 font. The 23-byte
+    header gives the bit widths of each glyph's w, h, x, y and dx fields,
+    which follow the glyph's encoding and jump bytes as an LSB-first
+    bitstream."""
+    bits_w, bits_h, bits_x, bits_y, bits_dx = data[4:9]
+    advances = {}
+    pos = 23
+    while pos + 1 < len(data) and data[pos + 1] != 0:
+        enc, jump = data[pos], data[pos + 1]
+        stream = int.from_bytes(data[pos + 2:pos + jump], "little")
+        shift = bits_w + bits_h + bits_x + bits_y
+        dx = (stream >> shift) & ((1 << bits_dx) - 1)
+        advances[chr(enc)] = dx - (1 << (bits_dx - 1))
+        pos += jump
+    return advances
+
+
+def measure_with(advances):
+    widest = max(advances.values())
+    return lambda text: sum(advances.get(c, widest) for c in text)
+
+
+def measurer(fonts=None, font=BODY_FONT):
+    """(measure, description) for a font by its Font name or u8g2 name,
+    from FIXED_ADVANCES or ADVANCES; with fonts, ADVANCES is checked
+    against the u8g2 font source first."""
+    name = FONTS.get(font, font)
+    if name in FIXED_ADVANCES:
+        advance = FIXED_ADVANCES[name]
+        return (lambda text: len(text) * advance), "%s, %d px per glyph" % (name, advance)
+    advances = ADVANCES[name]
+    if fonts:
+        source = font_advances(font_bytes(fonts, name))
+        wrong = "".join(c for c in GLYPHS if source.get(c) != advances[c])
+        if wrong:
+            raise SystemExit("%s: ADVANCES disagrees with %s for %r, update it"
+                             % (name, fonts, wrong))
+    return measure_with(advances), "%s (%s) glyph advances" % (font, name)
+
+
+def paragraphs(text):
+    """(start, end, indent) of each logical line: hand-wrapped prose
+    joined, everything else one per source line."""
+    lines, pos = [], 0
+    for raw in text.split("\n"):
+        lines.append((pos, raw))
+        pos += len(raw) + 1
+    out = []
+    for start, raw in lines:
+        indent = len(raw) - len(raw.lstrip(" "))
+        if out and raw and indent == 0 and raw[0].islower():
+            prev_start, prev_end, prev_indent = out[-1]
+            prev = text[prev_start:prev_end]
+            if prev and prev_indent == 0 and not prev.endswith(":"):
+                out[-1] = (prev_start, start + len(raw), 0)
+                continue
+        out.append((start, start + len(raw), indent))
+    return out
+
+
+def wrap(text, width, measure):
+    """[(offset, length, indent)] of each screen line of text."""
+    out = []
+    for start, end, indent in paragraphs(text):
+        pad = " " * indent
+        pos = start + indent
+        if pos >= end:
+            out.append((start, 0, 0))
+            continue
+        while pos < end:
+            fit = pos
+            while fit < end and measure(pad + text[pos:fit + 1].replace("\n", " ")) <= width:
+                fit += 1
+            if fit < end:
+                space = text.rfind(" ", pos, fit + 1)
+                newline = text.rfind("\n", pos, fit + 1)
+                cut = max(space, newline)
+                if cut > pos:
+                    fit = cut
+                elif fit == pos:
+                    fit = pos + 1  # a glyph wider than the line
+            if indent + fit - pos > LINE_MAX:
+                raise ValueError("line longer than the app's buffer: %r" % text[pos:fit])
+            out.append((pos, fit - pos, indent))
+            pos = fit
+            while pos < end and text[pos] in " \n":
+                pos += 1
+    return out
+
+
+def stored_at(encoded, fragments):
+    """(offset, skip) in encoded text of each expanded character, and of
+    the end."""
+    out = []
+    for i, c in enumerate(encoded):
+        n = len(fragments[ord(c) - 0x80]) if ord(c) >= 0x80 else 1
+        out += [(i, k) for k in range(n)]
+    return out + [(len(encoded), 0)]
+
+
+def table(name, count_name, docs, width, measure, encoded=None, fragments=None):
+    """Lines of docs wrapped to width; with the interned text, offsets
+    index it and a _line_skip table says where in a fragment each starts."""
+    lines, skips, first = [], [], []
+    for i, text in enumerate(docs):
+        first.append(len(lines))
+        at = stored_at(encoded[i], fragments) if encoded else None
+        for start, length, indent in wrap(text, width, measure):
+            off, skip = at[start] if at else (start, 0)
+            if off > 0xFFFF or length > 0xFF or indent > 0xFF:
+                raise ValueError("line does not fit a LayoutLine: %r" % text[start:start + 40])
+            lines.append((off, length, indent))
+            skips.append(skip)
+    first.append(len(lines))
+    out = ["static const LayoutLine %s_lines[] = {" % name]
+    for i in range(0, len(lines), 6):
+        out.append("    " + " ".join("{%d, %d, %d}," % l for l in lines[i:i + 6]))
+    out += ["};", "", "static const uint16_t %s_line_first[%s + 1] = {" % (name, count_name)]
+    for i in range(0, len(first), 12):
+        out.append("    " + " ".join("%d," % n for n in first[i:i + 12]))
+    out += ["};", ""]
+    if encoded:
+        out.append("static const uint8_t %s_line_skip[] = {" % name)
+        for i in range(0, len(skips), 24):
+            out.append("    " + " ".join("%d," % n for n in skips[i:i + 24]))
+        out += ["};", ""]
+    return out, len(lines)
+
+
+def render(sections, quiz, measure, metrics, dense_measure, dense_metrics):
+    docs = [c for _, c in sections]
+    fragments, encoded = intern(docs)
+    read, read_lines = table(
+        "manual", "LAYOUT_SECTION_COUNT", docs, READ_WIDTH, measure, encoded, fragments)
+    dense, dense_lines = table(
+        "manual_dense", "LAYOUT_SECTION_COUNT", docs, READ_WIDTH, dense_measure, encoded, fragments)
+    if [l.replace("manual_dense", "manual") for l in dense] == read:
+        dense = [
+            "/* the dense view wraps the same way */",
+            "#define manual_dense_lines manual_lines",
+            "#define manual_dense_line_first manual_line_first",
+            "#define manual_dense_line_skip manual_line_skip",
+            "",
+        ]
+    ask, ask_lines = table(
+        "quiz", "LAYOUT_QUIZ_COUNT", [d for d, _ in quiz], QUIZ_WIDTH, measure)
+    out = [
+        "/* Generated by tools/gen_manual_layout.py from manual/manual.txt. Do not edit. */",
+        "/* wrapped with %s; dense view with %s */" % (metrics, dense_metrics),
+        "",
+        "#define LAYOUT_SECTION_COUNT %d" % len(sections),
+        "#define LAYOUT_QUIZ_COUNT %d" % len(quiz),
+        "#define LAYOUT_FRAGMENT_COUNT %d" % len(fragments),
+        "",
+        "/* %d reader lines, %d dense, %d quiz lines */" % (read_lines, dense_lines, ask_lines),
+    ]
+    return "\n".join(out + read + dense + ask)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    ap.add_argument("--fonts", help="u8g2_fonts.c from the firmware tree, to check ADVANCES")
+    ap.add_argument("--font", default=BODY_FONT, choices=sorted(FONTS),
+                    help="font the reader and quiz draw with (default %(default)s)")
+    ap.add_argument("--check", action="store_true", help="fail if the layout is out of date")
+    args = ap.parse_args()
+
+    measure, metrics = measurer(args.fonts, args.font)
+    dense_measure, dense_metrics = measurer(font=DENSE_FONT)
+
+    sections, quiz = load()
+    text = render(sections, quiz, measure, metrics, dense_measure, dense_metrics)
+
+    if args.check:
+        try:
+            with open(OUTPUT) as f:
+                current = f.read()
+        except OSError:
+            current = ""
+        if re.search(r"wrapped with \d+ columns", current):
+            print("manual_layout.h was wrapped by column count; run tools/gen_manual_layout.py",
+                  file=sys.stderr)
+            return 1
+        if current != text:
+            print("manual_layout.h is stale; run tools/gen_manual_layout.py", file=sys.stderr)
+            return 1
+        return 0
+    with open(OUTPUT, "w") as f:
+        f.write(text)
+    print("%s: %s" % (os.path.relpath(OUTPUT, REPO), metrics))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
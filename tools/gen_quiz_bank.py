@@ -0,0 +1,119 @@
+#!/usr/bin/env python3
+"""gen_quiz_bank.py — Build quiz.bank, the SD card quiz, from manual/manual.txt
+
+Usage:
+  tools/gen_quiz_bank.py OUT
+  tools/gen_quiz_bank.py OUT --cards more.txt   # plus other files
+  tools/gen_quiz_bank.py OUT --fonts <firmware>/lib/u8g2/u8g2_fonts.c
+
+Extra card files use the manual's format: a '# Quiz' heading, then one card
+per paragraph ('? ' question, '= ' answer, '* ' correct option, '- ' others).
+Copy OUT to apps_data/<appid>/quiz.bank on the SD card; with it there the
+app asks questions from the bank instead of its 24 built-in cards.
+
+Layout (little-endian, see QuizBankHeader in claude_remote.c):
+
+  header    magic "QBNK", u16 version, u16 reserved, u32 count, u32 id
+  table     count x {u32 offset, u16 size, u16 reserved}, one per card
+  records   u8 correct option, u8 line count, u16 reserved,
+            line count x {u16 offset, u8 length, u8 indent},
+            question, answer and three options, each NUL-terminated
+
+The table entries are a fixed size, so the app finds card i by reading the
+entry at 16 + 8 * i and then that record alone. The question is pre-wrapped
+the same way gen_manual_layout.py wraps the built-in cards. The id is an
+FNV-1a hash of the records; the app keeps each card's Leitner box by its
+position, so a bank with different cards starts its progress over.
+"""
+
+import argparse
+import os
+import struct
+import sys
+
+from gen_manual import REPO, SOURCE, parse
+from gen_manual_layout import BODY_FONT, FONTS, QUIZ_WIDTH, measurer, wrap
+
+MAGIC = 0x4B4E4251  # "QBNK"
+VERSION = 2
+HEADER = struct.Struct("<IHHII")
+ENTRY = struct.Struct("<IHH")
+RECORD_HEAD = struct.Struct("<BBH")
+LINE = struct.Struct("<HBB")
+RECORD_MAX = 256  # QUIZ_RECORD_MAX
+ANSWER_MAX = 31  # what the app's answer and option buffers hold
+OPTION_MAX = 29  # after the "< " label
+
+
+def record(card, measure, where):
+    desc, answer, options, correct = card
+    text = [desc, answer] + options
+    if any(ord(c) >= 0x80 for t in text for c in t):
+        raise ValueError("%s: quiz text must be ASCII" % where)
+    lines = wrap(desc, QUIZ_WIDTH, measure)
+    if len(lines) > 0xFF:
+        raise ValueError("%s: question wraps to more than 255 lines" % where)
+    out = RECORD_HEAD.pack(correct, len(lines), 0)
+    out += b"".join(LINE.pack(*line) for line in lines)
+    out += b"".join(t.encode("ascii") + b"\0" for t in text)
+    if len(out) > RECORD_MAX:
+        raise ValueError("%s: record is %d bytes, the app reads %d" % (where, len(out), RECORD_MAX))
+    if len(answer) > ANSWER_MAX or any(len(o) > OPTION_MAX for o in options):
+        print("%s: answer or an option is cut short on screen" % where, file=sys.stderr)
+    return out
+
+
+def fnv1a(data):
+    h = 0x811C9DC5
+    for b in data:
+        h = ((h ^ b) * 0x01000193) & 0xFFFFFFFF
+    return h
+
+
+def build(cards, measure):
+    records = [record(card, measure, where) for card, where in cards]
+    table_end = HEADER.size + ENTRY.size * len(records)
+    body = b"".join(records)
+    out, table, pos = [HEADER.pack(MAGIC, VERSION, 0, len(records), fnv1a(body))], [], table_end
+    for rec in records:
+        table.append(ENTRY.pack(pos, len(rec), 0))
+        pos += len(rec)
+    if pos > 0xFFFFFFFF:
+        raise ValueError("bank too large")
+    return b"".join(out + table) + body
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    ap.add_argument("out", help="file to write, e.g. manual_output/quiz.bank")
+    ap.add_argument("--cards", nargs="*", default=[], help="more files with a '# Quiz' section")
+    ap.add_argument("--fonts", help="u8g2_fonts.c from the firmware tree, to check the advances")
+    ap.add_argument("--font", default=BODY_FONT, choices=sorted(FONTS),
+                    help="font the quiz draws with (default %(default)s)")
+    args = ap.parse_args()
+
+    measure, metrics = measurer(args.fonts, args.font)
+    cards = []
+    for path in [SOURCE] + args.cards:
+        name = os.path.relpath(path, REPO)
+        _, found = parse(path)
+        cards += [(card, "%s card %d" % (name, i)) for i, card in enumerate(found)]
+    if not cards:
+        print("no quiz cards found", file=sys.stderr)
+        return 1
+    if len(cards) > 0xFFFF:
+        print("%d cards; the app reads at most 65535" % len(cards), file=sys.stderr)
+        return 1
+
+    data = build(cards, measure)
+    out_dir = os.path.dirname(args.out)
+    if out_dir:
+        os.makedirs(out_dir, exist_ok=True)
+    with open(args.out, "wb") as f:
+        f.write(data)
+    print("%s: %d cards, %d bytes, wrapped with %s" % (args.out, len(cards), len(data), metrics))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,128 @@
+#!/usr/bin/env python3
+"""gen_search_index.py — Build the manual search index from manual/manual.txt
+
+Usage:
+  tools/gen_search_index.py            # rewrite manual_index.h
+  tools/gen_search_index.py --check    # exit 1 if manual_index.h is stale
+
+Reads the manual sections (in menu order) and quiz cards through
+gen_manual.load(), splits them into lowercase words, and writes an inverted
+index as static const data:
+
+  search_words[]     every distinct word, sorted, NUL-separated
+  search_terms[]     per word: offset into search_words, first posting
+  search_postings[]  doc << 8 | line, sorted, one per line a word is on
+
+Docs 0..SEARCH_SECTION_COUNT-1 are sections in menu order; the rest are quiz
+cards. A section title counts as line 0; a quiz card's description and answer
+are both line 0. Run it after editing manual or quiz text.
+"""
+
+import argparse
+import os
+import re
+import sys
+
+from gen_manual import REPO, load
+
+OUTPUT = os.path.join(REPO, "manual_index.h")
+
+MIN_WORD = 2
+STOP_WORDS = {
+    "an", "and", "are", "as", "at", "be", "by", "for", "from", "if", "in", "is",
+    "it", "its", "of", "on", "or", "the", "to", "with", "you", "your",
+}
+
+def words(text):
+    for w in re.split(r"[^a-z0-9]+", text.lower()):
+        if len(w) >= MIN_WORD and w not in STOP_WORDS:
+            yield w
+
+
+def build(sections, quiz):
+    postings = {}
+
+    def add(text, doc, line):
+        for w in words(text):
+            postings.setdefault(w, set()).add(doc << 8 | line)
+
+    for doc, (title, content) in enumerate(sections):
+        add(title, doc, 0)
+        for line, text in enumerate(content.split("\n")):
+            if line > 255:
+                raise ValueError("section %r is longer than 256 lines" % title)
+            add(text, doc, line)
+    for i, (desc, answer) in enumerate(quiz):
+        add(desc + " " + answer, len(sections) + i, 0)
+    if len(sections) + len(quiz) > 256:
+        raise ValueError("more than 256 docs")
+    return sorted(postings.items())
+
+
+def render(sections, quiz, index):
+    word_blob, terms, flat = [], [], []
+    word_off = 0
+    for word, posts in index:
+        terms.append((word_off, len(flat)))
+        word_blob.append(word)
+        word_off += len(word) + 1
+        flat += sorted(posts)
+    terms.append((word_off, len(flat)))
+    if word_off > 0xFFFF or len(flat) > 0xFFFF:
+        raise ValueError("index too large for 16-bit offsets")
+
+    out = [
+        "/* Generated by tools/gen_search_index.py from manual/manual.txt. Do not edit. */",
+        "",
+        "#define SEARCH_SECTION_COUNT %d" % len(sections),
+        "#define SEARCH_QUIZ_COUNT %d" % len(quiz),
+        "#define SEARCH_TERM_COUNT %d" % len(index),
+        "",
+        "/* %d words, %d postings, %d bytes */" % (
+            len(index), len(flat), word_off + 4 * len(terms) + 2 * len(flat)),
+        "static const char search_words[] =",
+    ]
+    line = '    "'
+    for word in word_blob:
+        piece = word + "\\000"  # three digits, so a word starting with one is not eaten
+        if len(line) + len(piece) > 98:
+            out.append(line + '"')
+            line = '    "'
+        line += piece
+    out.append(line + '";')
+    out += ["", "static const SearchTerm search_terms[SEARCH_TERM_COUNT + 1] = {"]
+    for i in range(0, len(terms), 6):
+        out.append("    " + " ".join("{%d, %d}," % t for t in terms[i:i + 6]))
+    out += ["};", "", "static const uint16_t search_postings[] = {"]
+    for i in range(0, len(flat), 10):
+        out.append("    " + " ".join("0x%04X," % p for p in flat[i:i + 10]))
+    out += ["};", ""]
+    return "\n".join(out)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    ap.add_argument("--check", action="store_true", help="fail if the index is out of date")
+    args = ap.parse_args()
+
+    sections, quiz = load()
+    text = render(sections, quiz, build(sections, quiz))
+
+    if args.check:
+        try:
+            with open(OUTPUT) as f:
+                current = f.read()
+        except OSError:
+            current = ""
+        if current != text:
+            print("manual_index.h is stale; run tools/gen_search_index.py", file=sys.stderr)
+            return 1
+        return 0
+    with open(OUTPUT, "w") as f:
+        f.write(text)
+    print("%s: %d sections, %d quiz cards" % (os.path.relpath(OUTPUT, REPO), len(sections), len(quiz)))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
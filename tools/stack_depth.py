@@ -0,0 +1,181 @@
+#!/usr/bin/env python3
+"""stack_depth.py — Static worst-case stack estimate for claude_remote.c
+
+Usage:
+  tools/stack_depth.py [--cdb compile_commands.json] [--cc CC] [-- extra cflags]
+  tools/stack_depth.py --ci claude_remote.ci
+
+Compiles claude_remote.c with GCC's -fcallgraph-info=su (GCC 10+), then walks
+the call graph from each thread entry point and prints the deepest call chain
+with per-frame sizes. Firmware API calls (canvas_*, storage_*, ...) are leaves
+whose own stack use is unknown here; they are counted with --ext-allowance.
+
+For numbers that match the device, use the ARM compiler and flags from ufbt:
+  ufbt cdb                      # writes build/compile_commands.json
+  tools/stack_depth.py --cdb build/compile_commands.json
+"""
+
+import argparse
+import json
+import os
+import re
+import shlex
+import subprocess
+import sys
+import tempfile
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+REPO = os.path.dirname(HERE)
+SOURCE = os.path.join(REPO, "claude_remote.c")
+
+# thread entry points: (function, thread it runs on)
+ROOTS = [
+    ("claude_remote_usb_app", "app main"),
+    ("claude_remote_ble_app", "app main"),
+    ("draw_callback", "gui"),
+    ("input_callback", "input service"),
+    ("bt_status_callback", "bt service"),
+    ("usb_state_callback", "usb service"),
+    ("storage_worker_thread", "storage worker"),
+]
+
+NODE_RE = re.compile(r'node: \{ title: "([^"]+)" label: "([^"]*)"( shape : ellipse)? \}')
+EDGE_RE = re.compile(r'edge: \{ sourcename: "([^"]+)" targetname: "([^"]+)"')
+SU_RE = re.compile(r"\\n(\d+) bytes \(([a-z,]+)\)")
+
+
+def app_stack_size():
+    """Read stack_size from application.fam (first App())."""
+    try:
+        with open(os.path.join(REPO, "application.fam")) as f:
+            m = re.search(r"stack_size\s*=\s*([0-9* ]+)", f.read())
+        return eval(m.group(1)) if m else None  # "2 * 1024"
+    except OSError:
+        return None
+
+
+def short(title):
+    # "path/claude_remote.c:draw_remote.isra.0" -> "draw_remote.isra.0"
+    return title.rsplit(":", 1)[-1]
+
+
+def parse_ci(paths):
+    frames, kinds, external, edges = {}, {}, set(), {}
+    for path in paths:
+        with open(path) as f:
+            for line in f:
+                m = NODE_RE.search(line)
+                if m:
+                    title, label, ellipse = m.groups()
+                    su = SU_RE.search(label)
+                    if ellipse or not su:
+                        external.add(title)
+                    else:
+                        frames[title] = int(su.group(1))
+                        kinds[title] = su.group(2)
+                    continue
+                m = EDGE_RE.search(line)
+                if m:
+                    edges.setdefault(m.group(1), set()).add(m.group(2))
+    return frames, kinds, external, edges
+
+
+def compile_ci(args, outdir):
+    cmd = None
+    if args.cdb:
+        with open(args.cdb) as f:
+            for entry in json.load(f):
+                if os.path.basename(entry["file"]) == "claude_remote.c":
+                    cmd = entry.get("arguments") or shlex.split(entry["command"])
+                    os.chdir(entry.get("directory", "."))
+                    break
+        if cmd is None:
+            sys.exit("claude_remote.c not found in " + args.cdb)
+        # drop -o <obj>, write our own object into the temp dir
+        clean = []
+        skip = False
+        for a in cmd:
+            if skip:
+                skip = False
+                continue
+            if a == "-o":
+                skip = True
+                continue
+            clean.append(a)
+        cmd = clean
+    else:
+        cmd = [args.cc, "-c", "-Os", SOURCE] + args.cflags
+    obj = os.path.join(outdir, "claude_remote.o")
+    cmd += ["-fcallgraph-info=su", "-o", obj]
+    subprocess.run(cmd, check=True)
+    return [os.path.join(outdir, f) for f in os.listdir(outdir) if f.endswith(".ci")]
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("--ci", nargs="*", help="analyze existing .ci files instead of compiling")
+    ap.add_argument("--cdb", help="compile_commands.json to take the compile line from")
+    ap.add_argument("--cc", default="arm-none-eabi-gcc")
+    ap.add_argument("--ext-allowance", type=int, default=128,
+                    help="bytes assumed for each firmware API call (default 128)")
+    ap.add_argument("cflags", nargs="*", help="extra flags after --")
+    args = ap.parse_args()
+
+    with tempfile.TemporaryDirectory() as tmp:
+        paths = args.ci or compile_ci(args, tmp)
+        frames, kinds, external, edges = parse_ci(paths)
+
+    by_name = {short(t): t for t in frames}
+    memo = {}
+
+    def depth(title, stack):
+        """Worst-case bytes below (and including) title, plus the chain."""
+        if title in memo:
+            return memo[title]
+        if title in external:
+            cost = 0 if title == "__indirect_call" else args.ext_allowance
+            return cost, [(title, cost, "ext")]
+        if title in stack:
+            return 0, [(title, 0, "RECURSION")]
+        stack.add(title)
+        best, chain = 0, []
+        for callee in edges.get(title, ()):
+            d, c = depth(callee, stack)
+            if d > best or not chain:
+                best, chain = d, c
+        stack.discard(title)
+        own = frames.get(title, 0)
+        result = (own + best, [(title, own, kinds.get(title, "?"))] + chain)
+        memo[title] = result
+        return result
+
+    limit = app_stack_size()
+    print("Worst-case stack per thread entry (ext allowance %d B/call)" % args.ext_allowance)
+    for name, thread in ROOTS:
+        title = by_name.get(name)
+        if title is None:
+            # constprop/isra clones keep the base name as a prefix
+            title = next((t for n, t in by_name.items() if n.split(".")[0] == name), None)
+        if title is None:
+            continue
+        total, chain = depth(title, set())
+        note = ""
+        if thread == "app main" and limit:
+            verdict = ("OK" if total * 4 <= limit * 3 else
+                       "TIGHT, raise stack_size" if total < limit else "OVERFLOW RISK")
+            note = "  (stack_size %d, %d%%, %s)" % (limit, total * 100 // limit, verdict)
+        print("\n%s [%s]: %d bytes%s" % (name, thread, total, note))
+        for fn, size, kind in chain:
+            flag = "" if kind == "static" else "  <%s>" % kind
+            print("  %6d  %s%s" % (size, short(fn), flag))
+
+    dynamic = [short(t) for t, k in kinds.items() if k != "static"]
+    if dynamic:
+        print("\nFrames with dynamic size (estimate is a lower bound): " + ", ".join(sorted(dynamic)))
+    indirect = sorted(short(s) for s, ts in edges.items() if "__indirect_call" in ts)
+    if indirect:
+        print("Indirect calls not followed from: " + ", ".join(indirect))
+
+
+if __name__ == "__main__":
+    main()